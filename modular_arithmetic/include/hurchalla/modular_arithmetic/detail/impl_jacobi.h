@@ -0,0 +1,128 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MODULAR_ARITHMETIC_IMPL_JACOBI_H_INCLUDED
+#define HURCHALLA_MODULAR_ARITHMETIC_IMPL_JACOBI_H_INCLUDED
+
+
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/count_trailing_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <type_traits>
+#include <cstdint>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: this is the binary Jacobi symbol algorithm (see for
+// example Algorithm 2.3.5 in "Prime Numbers: A Computational Perspective" by
+// Crandall and Pomerance, and its binary variant described by Shallit and
+// Sorenson).  Each step removes all the factors of 2 from a with a single
+// count_trailing_zeros and shift, using (2/n) == -1 if and only if n mod 8 is
+// 3 or 5; then if a < n it swaps a and n, using quadratic reciprocity; then it
+// subtracts n from a.  There are no divisions, and on average each step
+// removes about two bits from a.
+//
+// We track the sign as the low bit of an unsigned integer 'flip', and update
+// it with xors of bits of a and n rather than with branches.  Once both a and
+// n fit in a narrower native type, we continue the loop with that type, since
+// for example 64 bit arithmetic is much faster than 128 bit arithmetic.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_jacobi {
+
+  // Returns the Jacobi symbol (a/n).  Requires n to be odd.
+  template <typename T>
+  static int call(T a, T n)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    HPBC_CLOCKWORK_PRECONDITION2(n % 2 == 1);
+    if (a >= n)
+        a = static_cast<T>(a % n);
+    using W = typename std::conditional<
+                  (ut_numeric_limits<T>::digits <= 32), std::uint32_t,
+                  typename std::conditional<
+                      (ut_numeric_limits<T>::digits <= 64), std::uint64_t,
+                      T>::type
+                  >::type;
+    unsigned int flip = loop(static_cast<W>(a), static_cast<W>(n), 0u);
+    return (flip == 0) ? 1 : ((flip == 1) ? -1 : 0);
+  }
+
+private:
+  // The loop functions return 0 if (a/n) == 1, 1 if (a/n) == -1, or 2 if
+  // (a/n) == 0.  Requires n odd.  They are fastest when a < n.
+
+  // Performs one step of the algorithm.  Requires a != 0, and n odd.
+  template <typename T> HURCHALLA_FORCE_INLINE
+  static void step(T& a, T& n, unsigned int& flip)
+  {
+    int z = count_trailing_zeros(a);
+    a = static_cast<T>(a >> z);
+    // (n>>1) ^ (n>>2) has its low bit set when n mod 8 is 3 or 5
+    unsigned int low_n = static_cast<unsigned int>(n);
+    flip ^= static_cast<unsigned int>(z) & ((low_n >> 1) ^ (low_n >> 2));
+    if (a < n) {
+        T tmp = a;
+        a = n;
+        n = tmp;
+        // by quadratic reciprocity, (a/n) == -(n/a) if both are 3 mod 4
+        unsigned int low_a = static_cast<unsigned int>(a);
+        low_n = static_cast<unsigned int>(n);
+        flip ^= (low_a & low_n) >> 1;
+    }
+  }
+
+  static unsigned int loop(std::uint32_t a, std::uint32_t n, unsigned int flip)
+  {
+    HPBC_CLOCKWORK_PRECONDITION2(n % 2 == 1);
+    while (a != 0) {
+        step(a, n, flip);
+        a = a - n;
+    }
+    return (n == 1) ? (flip & 1u) : 2u;
+  }
+
+  static unsigned int loop(std::uint64_t a, std::uint64_t n, unsigned int flip)
+  {
+    HPBC_CLOCKWORK_PRECONDITION2(n % 2 == 1);
+    while (a != 0) {
+        step(a, n, flip);
+        // a >= n here, so if a fits in 32 bits, then so does n
+        if ((a >> 32) == 0) {
+            return loop(static_cast<std::uint32_t>(a - n),
+                        static_cast<std::uint32_t>(n), flip);
+        }
+        a = a - n;
+    }
+    return (n == 1) ? (flip & 1u) : 2u;
+  }
+
+#if (HURCHALLA_COMPILER_HAS_UINT128_T())
+  static unsigned int loop(__uint128_t a, __uint128_t n, unsigned int flip)
+  {
+    HPBC_CLOCKWORK_PRECONDITION2(n % 2 == 1);
+    while (a != 0) {
+        step(a, n, flip);
+        if ((a >> 64) == 0) {
+            return loop(static_cast<std::uint64_t>(a - n),
+                        static_cast<std::uint64_t>(n), flip);
+        }
+        a = a - n;
+    }
+    return (n == 1) ? (flip & 1u) : 2u;
+  }
+#endif
+};
+
+
+}} // end namespace
+
+#endif
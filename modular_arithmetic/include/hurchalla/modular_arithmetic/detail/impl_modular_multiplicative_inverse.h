@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2022 Jeffrey Hurchalla.
+// Copyright (c) 2020-2025 Jeffrey Hurchalla.
 /*
  * This Source Code Form is subject to the terms of the Mozilla Public
  * License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,7 +12,10 @@
 #include "hurchalla/util/traits/extensible_make_signed.h"
 #include "hurchalla/util/traits/safely_promote_unsigned.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/unsigned_multiply_to_hilo_product.h"
+#include "hurchalla/util/count_trailing_zeros.h"
 #include "hurchalla/util/conditional_select.h"
+#include "hurchalla/util/sized_uint.h"
 #include "hurchalla/util/compiler_macros.h"
 #include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
 #include <type_traits>
@@ -20,10 +23,46 @@
 namespace hurchalla { namespace detail {
 
 
-// note: uses a static member function to disallow ADL.
+// note: uses static member functions to disallow ADL.
 struct impl_modular_multiplicative_inverse {
   template <typename T>
   HURCHALLA_FORCE_INLINE static T call(T val, T modulus, T& gcd)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    HPBC_CLOCKWORK_PRECONDITION2(modulus > 1);
+
+    if HURCHALLA_CPP17_CONSTEXPR (prefers_binary<T>()) {
+        if (modulus % 2 == 1)
+            return call_binary(val, modulus, gcd);
+    }
+    return call_euclidean(val, modulus, gcd);
+  }
+
+
+  // Returns true if call() uses the binary algorithm for an odd modulus.
+  // The extended Euclidean algorithm needs a division for every step.  When
+  // T is wider than the CPU's native registers, that division is usually a
+  // call to a (slow) library function, and when the CPU has no divide
+  // instruction, it always is.  In those cases we prefer the division-free
+  // binary algorithm.
+  // On x86_64 with gcc, for random inputs with an odd modulus, the binary
+  // algorithm measured 3-8% faster for __uint128_t, but 5-40% slower for
+  // uint32_t and uint64_t, which have a hardware divide.
+  template <typename T>
+  static constexpr bool prefers_binary()
+  {
+#if defined(HURCHALLA_TARGET_ISA_HAS_NO_DIVIDE)
+    return true;
+#else
+    return (ut_numeric_limits<typename safely_promote_unsigned<T>::type>::digits
+                                                  > HURCHALLA_TARGET_BIT_WIDTH);
+#endif
+  }
+
+
+  template <typename T>
+  HURCHALLA_FORCE_INLINE static T call_euclidean(T val, T modulus, T& gcd)
   {
     static_assert(ut_numeric_limits<T>::is_integer, "");
     static_assert(!(ut_numeric_limits<T>::is_signed), "");
@@ -75,6 +114,152 @@ struct impl_modular_multiplicative_inverse {
         return 0;
     }
   }
+
+
+  // Has the same postconditions as call_euclidean(), but requires an odd
+  // modulus, and uses no division.
+  template <typename T>
+  static T call_binary(T val, T modulus, T& gcd)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    HPBC_CLOCKWORK_PRECONDITION2(modulus > 1);
+    HPBC_CLOCKWORK_PRECONDITION2(modulus % 2 == 1);
+
+    using U = typename safely_promote_unsigned<T>::type;
+    int k;
+    T s = call_almost_inverse(val, modulus, gcd, k);
+    if (s == 0)
+        return 0;
+    U inv = divide_by_pow2(static_cast<U>(s), k, static_cast<U>(modulus));
+    HPBC_CLOCKWORK_POSTCONDITION2(0 < inv && inv < modulus);
+    return static_cast<T>(inv);
+  }
+
+
+  // Requires an odd modulus.  Sets gcd to the greatest common divisor of val
+  // and modulus.  If the gcd is 1, this returns the "almost inverse" s, and
+  // sets k, such that  val*s == 2^k (mod modulus),  with 0 < s < modulus and
+  // 0 < k <= 2*digits (where digits is the bit width of T, or of unsigned int
+  // if T is smaller).  Otherwise it returns 0.  Uses no division.
+  template <typename T>
+  static T call_almost_inverse(T val, T modulus, T& gcd, int& k)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    HPBC_CLOCKWORK_PRECONDITION2(modulus > 1);
+    HPBC_CLOCKWORK_PRECONDITION2(modulus % 2 == 1);
+
+    using U = typename safely_promote_unsigned<T>::type;
+
+    k = 0;
+    if (val == 0) {
+        gcd = modulus;
+        return 0;
+    }
+    // This is a variant of Kaliski's "almost inverse" algorithm (see "The
+    // Montgomery inverse and its applications", IEEE Transactions on
+    // Computers, 1995), which removes all the factors of two from u or v in a
+    // single step.  We keep u and v odd, and maintain the invariants
+    //    modulus == u*s + v*r,   and   val*s == v*(2^k)  (mod modulus).
+    // The first invariant guarantees that s and r never exceed the modulus.
+    // When the loop ends, u == v == gcd(val, modulus), and if the gcd is 1, we
+    // have val*s == 2^k.
+    U u = modulus;
+    U v = val;
+    U r = 0;
+    U s = 1;
+    k = count_trailing_zeros(v);
+    v = static_cast<U>(v >> k);
+
+    // If U is wider than the CPU's native registers, we switch to native
+    // arithmetic for u and v as soon as they both fit in a native register.
+    using N = typename sized_uint<HURCHALLA_TARGET_BIT_WIDTH>::type;
+    using W = typename std::conditional<
+                   (ut_numeric_limits<U>::digits > ut_numeric_limits<N>::digits),
+                   N, U>::type;
+    constexpr U wmax = static_cast<U>(ut_numeric_limits<W>::max());
+    while (u != v && (u > wmax || v > wmax))
+        binary_step(u, v, r, s, k);
+    if (u <= wmax && v <= wmax) {
+        W uw = static_cast<W>(u);
+        W vw = static_cast<W>(v);
+        while (uw != vw)
+            binary_step(uw, vw, r, s, k);
+        u = uw;
+    }
+    HPBC_CLOCKWORK_ASSERT2(u % 2 == 1);
+
+    if (u != 1) {
+        gcd = static_cast<T>(u);
+        HPBC_CLOCKWORK_ASSERT2(gcd > 1);
+        return 0;
+    }
+    gcd = 1;
+    HPBC_CLOCKWORK_POSTCONDITION2(0 < s && s < modulus);
+    HPBC_CLOCKWORK_POSTCONDITION2(0 < k && k <= 2*ut_numeric_limits<U>::digits);
+    return static_cast<T>(s);
+  }
+
+private:
+  template <typename W, typename U>
+  HURCHALLA_FORCE_INLINE static void binary_step(W& u, W& v, U& r, U& s, int& k)
+  {
+    HPBC_CLOCKWORK_PRECONDITION2(u % 2 == 1 && v % 2 == 1 && u != v);
+    if (u > v) {
+        u = static_cast<W>(u - v);
+        r = static_cast<U>(r + s);
+        int j = count_trailing_zeros(u);
+        u = static_cast<W>(u >> j);
+        s = static_cast<U>(s << j);
+        k += j;
+    } else {
+        v = static_cast<W>(v - u);
+        s = static_cast<U>(s + r);
+        int j = count_trailing_zeros(v);
+        v = static_cast<W>(v >> j);
+        r = static_cast<U>(r << j);
+        k += j;
+    }
+  }
+
+  // Returns x*(2^-k) (mod modulus), for an odd modulus and x < modulus.  Rather
+  // than halving k times, we use Montgomery reductions that each divide by up
+  // to 2^digits (where digits is the bit width of U).
+  template <typename U>
+  static U divide_by_pow2(U x, int k, U modulus)
+  {
+    HPBC_CLOCKWORK_PRECONDITION2(modulus % 2 == 1);
+    HPBC_CLOCKWORK_PRECONDITION2(x < modulus);
+    HPBC_CLOCKWORK_PRECONDITION2(k >= 0);
+    constexpr int digits = ut_numeric_limits<U>::digits;
+
+    // Newton's method for the inverse of modulus (mod 2^digits).  Any odd
+    // number is its own inverse mod 8, so we start with 3 correct bits, and
+    // each iteration doubles the number of correct bits.
+    U inv = modulus;
+    for (int i = 3; i < digits; i *= 2)
+        inv = static_cast<U>(inv * static_cast<U>(2 - modulus * inv));
+    U neg_inv = static_cast<U>(0 - inv);
+
+    while (k > 0) {
+        int j = (k < digits) ? k : digits;
+        // m is chosen so that x + m*modulus is divisible by 2^j.  Since
+        // x < modulus and m < 2^j, the quotient is less than modulus.
+        U m = static_cast<U>(x * neg_inv);
+        if (j < digits)
+            m = static_cast<U>(m & static_cast<U>((static_cast<U>(1) << j) - 1));
+        U lo;
+        U hi = unsigned_multiply_to_hilo_product(lo, m, modulus);
+        lo = static_cast<U>(lo + x);
+        hi = static_cast<U>(hi + static_cast<U>(lo < x));
+        x = (j < digits) ? static_cast<U>((hi << (digits - j)) | (lo >> j))
+                         : hi;
+        HPBC_CLOCKWORK_ASSERT2(x < modulus);
+        k -= j;
+    }
+    return x;
+  }
 };
 
 
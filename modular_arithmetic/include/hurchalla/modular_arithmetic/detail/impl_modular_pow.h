@@ -1,4 +1,4 @@
-// Copyright (c) 2020-2022 Jeffrey Hurchalla.
+// Copyright (c) 2020-2025 Jeffrey Hurchalla.
 /*
  * This Source Code Form is subject to the terms of the Mozilla Public
  * License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,8 @@
 #include "hurchalla/util/cselect_on_bit.h"
 #include "hurchalla/util/compiler_macros.h"
 #include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
 
 namespace hurchalla { namespace detail {
 
@@ -63,6 +65,88 @@ struct impl_modular_pow {
     }
     return static_cast<T>(result);
   }
+
+  // Array version of call(), which raises every element of 'bases' to the
+  // same exponent (mod modulus).  Each squaring or multiply in call() must wait
+  // for the (long latency) modular multiplication before it, so rather than
+  // computing one power after another, we interleave the independent chains
+  // of all the bases, to let the CPU work on them in parallel.
+  template <typename T, typename U, std::size_t N>
+  static std::array<T,N> call(std::array<T,N> bases, U exponent, T modulus)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<U>::is_integer, "");
+    static_assert(!(ut_numeric_limits<U>::is_signed), "");
+    HPBC_CLOCKWORK_PRECONDITION2(modulus > 1);
+
+    namespace hc = ::hurchalla;
+    std::array<T,N> result;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+       if (bases[i] >= modulus)
+          bases[i] = static_cast<T>(bases[i] % modulus);
+       result[i] = ::hurchalla::cselect_on_bit<0>::ne_0(
+                  static_cast<uint64_t>(exponent), bases[i], static_cast<T>(1));
+    }
+    while (exponent > 1)
+    {
+       exponent = static_cast<U>(exponent >> 1);
+       HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+          bases[i] = hc::modular_multiplication_prereduced_inputs(
+                                                 bases[i], bases[i], modulus);
+       }
+       if (exponent & 1u) {
+          HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+             result[i] = hc::modular_multiplication_prereduced_inputs(
+                                                 result[i], bases[i], modulus);
+          }
+       }
+    }
+    return result;
+  }
+
+  // Array version of call(), which computes bases[i]^exponents[i] (mod
+  // moduli[i]) for every i, interleaving the independent chains as above.
+  // We loop until the largest exponent is exhausted; a lane whose exponent
+  // is shorter just stops updating its result.
+  template <typename T, typename U, std::size_t N>
+  static std::array<T,N> call(std::array<T,N> bases,
+                              std::array<U,N> exponents,
+                              const std::array<T,N>& moduli)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<U>::is_integer, "");
+    static_assert(!(ut_numeric_limits<U>::is_signed), "");
+
+    namespace hc = ::hurchalla;
+    std::array<T,N> result;
+    U maxexp = 0;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+       HPBC_CLOCKWORK_PRECONDITION2(moduli[i] > 1);
+       if (bases[i] >= moduli[i])
+          bases[i] = static_cast<T>(bases[i] % moduli[i]);
+       result[i] = ::hurchalla::cselect_on_bit<0>::ne_0(
+              static_cast<uint64_t>(exponents[i]), bases[i], static_cast<T>(1));
+       maxexp = (exponents[i] > maxexp) ? exponents[i] : maxexp;
+    }
+    while (maxexp > 1)
+    {
+       maxexp = static_cast<U>(maxexp >> 1);
+       HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+          exponents[i] = static_cast<U>(exponents[i] >> 1);
+          bases[i] = hc::modular_multiplication_prereduced_inputs(
+                                              bases[i], bases[i], moduli[i]);
+       }
+       HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+          if (exponents[i] & 1u) {
+             result[i] = hc::modular_multiplication_prereduced_inputs(
+                                              result[i], bases[i], moduli[i]);
+          }
+       }
+    }
+    return result;
+  }
 };
 
 
@@ -0,0 +1,64 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MODULAR_ARITHMETIC_JACOBI_H_INCLUDED
+#define HURCHALLA_MODULAR_ARITHMETIC_JACOBI_H_INCLUDED
+
+
+#include "hurchalla/modular_arithmetic/detail/impl_jacobi.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstddef>
+
+namespace hurchalla {
+
+
+// Returns the Jacobi symbol (a/n), which is 1, -1, or 0.  It requires n to be
+// odd.  When n is prime, this is the Legendre symbol: it returns 0 if 'a' is
+// divisible by n, 1 if 'a' is a nonzero quadratic residue mod n, and -1 if 'a'
+// is a quadratic nonresidue mod n.
+//
+// Note: Calling with a < n slightly improves performance.  The computation
+// uses no divisions (aside from reducing an 'a' that is >= n), and it uses
+// native 64 or 32 bit arithmetic once the values become small enough, so a
+// 128 bit (a/n) costs only somewhat more than two 64 bit computations.
+template <typename T>
+int jacobi(T a, T n)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    HPBC_CLOCKWORK_API_PRECONDITION(n % 2 == 1);
+
+    int result = detail::impl_jacobi::call(a, n);
+
+    HPBC_CLOCKWORK_POSTCONDITION(result == 1 || result == -1 || result == 0);
+    HPBC_CLOCKWORK_POSTCONDITION(n != 1 || result == 1);
+    return result;
+}
+
+// Batch version of the above function, for a single modulus n and many values.
+// It sets result[i] to the Jacobi symbol (a[i]/n), for every i < count.  The
+// arrays 'result' and 'a' must not overlap.  This is a convenience; it performs
+// about the same as calling jacobi() for each element, since the computation
+// is limited mostly by branch mispredictions.
+template <typename T>
+void jacobi(int* HURCHALLA_RESTRICT result, const T* HURCHALLA_RESTRICT a,
+            std::size_t count, T n)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    HPBC_CLOCKWORK_API_PRECONDITION(n % 2 == 1);
+
+    for (std::size_t i = 0; i < count; ++i)
+        result[i] = detail::impl_jacobi::call(a[i], n);
+}
+
+
+}  // end namespace
+
+#endif
@@ -12,6 +12,8 @@
 #include "hurchalla/modular_arithmetic/detail/impl_modular_pow.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
 #include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
 
 namespace hurchalla {
 
@@ -39,6 +41,63 @@ T modular_pow(T base, U exponent, T modulus)
 }
 
 
+// Array version of modular_pow(), which returns an array with element i set to
+// bases[i] raised to the exponent (mod modulus).  The exponentiations of the
+// different bases are interleaved, so that the CPU can overlap their (long
+// latency) modular multiplications.  Typically this is much faster than
+// calling modular_pow() separately for each base.  Note that if your modulus
+// is odd, the array pow() of MontgomeryForm will likely be faster still.
+
+template <typename T, typename U, std::size_t NUM_BASES>
+std::array<T, NUM_BASES>
+modular_pow(const std::array<T, NUM_BASES>& bases, U exponent, T modulus)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<U>::is_integer, "");
+    static_assert(!(ut_numeric_limits<U>::is_signed), "");
+    HPBC_CLOCKWORK_API_PRECONDITION(modulus > 1);
+
+    std::array<T, NUM_BASES> result =
+                       detail::impl_modular_pow::call(bases, exponent, modulus);
+
+    for (std::size_t i=0; i<NUM_BASES; ++i) {
+        HPBC_CLOCKWORK_POSTCONDITION(result[i] < modulus);
+    }
+    return result;
+}
+
+
+// Array version of modular_pow(), which returns an array with element i set to
+// bases[i] raised to exponents[i] (mod moduli[i]).  Like the version above,
+// this interleaves the exponentiations so that the CPU can overlap them.  If
+// your moduli are odd, the array pow() that MontgomeryForm provides for
+// multiple MontgomeryForm objects will likely be faster.
+
+template <typename T, typename U, std::size_t NUM_BASES>
+std::array<T, NUM_BASES>
+modular_pow(const std::array<T, NUM_BASES>& bases,
+            const std::array<U, NUM_BASES>& exponents,
+            const std::array<T, NUM_BASES>& moduli)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<U>::is_integer, "");
+    static_assert(!(ut_numeric_limits<U>::is_signed), "");
+    for (std::size_t i=0; i<NUM_BASES; ++i) {
+        HPBC_CLOCKWORK_API_PRECONDITION(moduli[i] > 1);
+    }
+
+    std::array<T, NUM_BASES> result =
+                       detail::impl_modular_pow::call(bases, exponents, moduli);
+
+    for (std::size_t i=0; i<NUM_BASES; ++i) {
+        HPBC_CLOCKWORK_POSTCONDITION(result[i] < moduli[i]);
+    }
+    return result;
+}
+
+
 }  // end namespace
 
 #endif
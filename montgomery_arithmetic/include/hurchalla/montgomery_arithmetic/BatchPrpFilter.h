@@ -0,0 +1,183 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_BATCH_PRP_FILTER_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_BATCH_PRP_FILTER_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/impl_batch_prp_filter.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/count_leading_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hurchalla {
+
+
+// BatchPrpFilter applies the base 2 strong probable prime test to a stream of
+// candidate numbers, and outputs the candidates that pass (the "survivors").
+// Every prime passes the test, and only rare composites pass it, so this is
+// intended as a fast first filter for a stream of prime candidates, usually
+// followed by a full primality test (such as is_prime_miller_rabin()) on the
+// survivors.
+//
+// Internally it tests LANES candidates at a time with the array version of
+// montgomery two_pow, with a separate MontgomeryForm for each candidate.  The
+// time of the array two_pow depends on the largest exponent in the array, and
+// so a lane with a small candidate would be mostly wasted if it were grouped
+// with larger candidates.  To avoid this, BatchPrpFilter keeps a separate
+// bucket for each bit length of candidate, and it tests a bucket only once it
+// holds LANES candidates (or when you call flush()).  Since every candidate in
+// a bucket has the same bit length, the bucket can also use the fastest
+// MontgomeryForm type for that length: MontgomeryQuarter, MontgomeryHalf, or
+// MontgomeryFull.
+//
+// The survivors are written to an output iterator as they are found.  Note
+// that they are not necessarily output in the same order that the candidates
+// were given, and that candidates may remain pending in a bucket until you
+// call flush().
+//
+// T must be an unsigned integral type.  For your stream of candidates you
+// should use the smallest T that can hold them, since smaller types are faster.
+// LANES is the number of candidates tested together; the best value depends
+// on your CPU and type T, and you can measure it with the testbench in
+// detail/experimental/prp_filter.
+//
+// Example:
+//   hurchalla::BatchPrpFilter<std::uint64_t> filter;
+//   std::vector<std::uint64_t> survivors;
+//   auto out = std::back_inserter(survivors);
+//   for (std::uint64_t x = start; x < stop; x += 2)
+//       out = filter.push(x, out);
+//   out = filter.flush(out);
+template <typename T, std::size_t LANES = 4>
+class BatchPrpFilter final {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(LANES > 0, "");
+
+    static constexpr int DIGITS = ut_numeric_limits<T>::digits;
+    static constexpr std::size_t NUM_BUCKETS =
+                                       static_cast<std::size_t>(DIGITS) + 1;
+
+    // buckets_[b] holds the pending candidates with a bit length of b, and
+    // counts_[b] is the number of candidates it holds.
+    std::array<std::array<T, LANES>, NUM_BUCKETS> buckets_;
+    std::array<std::size_t, NUM_BUCKETS> counts_;
+    std::uint64_t num_candidates_;
+    std::uint64_t num_survivors_;
+
+ public:
+    BatchPrpFilter() : buckets_(), counts_(), num_candidates_(0),
+                       num_survivors_(0) {}
+
+    // Adds candidate x to the stream.  If this completes a bucket, the bucket
+    // is tested and its survivors are written to out.  Returns the output
+    // iterator one past the last survivor written.
+    template <class OutputIt>
+    OutputIt push(T x, OutputIt out)
+    {
+        ++num_candidates_;
+        if (x < 3 || x % 2 == 0) {
+            // 2 is the only even prime, and 1 and 0 are not prime
+            if (x == 2) {
+                *out++ = x;
+                ++num_survivors_;
+            }
+            return out;
+        }
+        int b = DIGITS - count_leading_zeros(x);
+        HPBC_CLOCKWORK_ASSERT2(2 <= b && b <= DIGITS);
+        std::size_t ub = static_cast<std::size_t>(b);
+        buckets_[ub][counts_[ub]] = x;
+        if (++counts_[ub] == LANES)
+            out = test_bucket(b, out);
+        return out;
+    }
+
+    // Tests every candidate that is still pending, and writes the survivors to
+    // out.  Returns the output iterator one past the last survivor written.
+    template <class OutputIt>
+    OutputIt flush(OutputIt out)
+    {
+        for (int b = 2; b <= DIGITS; ++b) {
+            if (counts_[static_cast<std::size_t>(b)] > 0)
+                out = test_bucket(b, out);
+        }
+        return out;
+    }
+
+    // Pushes every candidate in the range [first, last), and then flushes.
+    template <class InputIt, class OutputIt>
+    OutputIt filter(InputIt first, InputIt last, OutputIt out)
+    {
+        for (; first != last; ++first)
+            out = push(*first, out);
+        return flush(out);
+    }
+
+    // Returns the number of candidates that have been pushed.  This includes
+    // any that are still pending.
+    std::uint64_t candidates() const { return num_candidates_; }
+
+    // Returns the number of survivors that have been output.
+    std::uint64_t survivors() const { return num_survivors_; }
+
+    // Returns the number of candidates that are pending in the buckets.
+    std::size_t pending() const
+    {
+        std::size_t total = 0;
+        for (std::size_t c : counts_)
+            total += c;
+        return total;
+    }
+
+ private:
+    template <class OutputIt>
+    OutputIt test_bucket(int b, OutputIt out)
+    {
+        std::size_t ub = static_cast<std::size_t>(b);
+        std::size_t count = counts_[ub];
+        HPBC_CLOCKWORK_PRECONDITION2(0 < count && count <= LANES);
+        std::array<T, LANES>& n = buckets_[ub];
+        // for a partial bucket, we fill the unused lanes with copies of the
+        // first candidate, and ignore their results.
+        for (std::size_t i = count; i < LANES; ++i)
+            n[i] = n[0];
+
+        std::array<bool, LANES> passed;
+        // For small T, MontgomeryHalf and MontgomeryFull are the same type.
+        if (b <= DIGITS - 2)
+            detail::impl_batch_prp_filter::call<MontgomeryQuarter<T>>(n, passed);
+        else if HURCHALLA_CPP17_CONSTEXPR
+                    (std::is_same<MontgomeryHalf<T>, MontgomeryFull<T>>::value)
+            detail::impl_batch_prp_filter::call<MontgomeryFull<T>>(n, passed);
+        else if (b == DIGITS - 1)
+            detail::impl_batch_prp_filter::call<MontgomeryHalf<T>>(n, passed);
+        else
+            detail::impl_batch_prp_filter::call<MontgomeryFull<T>>(n, passed);
+
+        for (std::size_t i = 0; i < count; ++i) {
+            if (passed[i]) {
+                *out++ = n[i];
+                ++num_survivors_;
+            }
+        }
+        counts_[ub] = 0;
+        return out;
+    }
+};
+
+
+} // end namespace
+
+#endif
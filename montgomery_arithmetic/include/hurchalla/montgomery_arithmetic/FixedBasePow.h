@@ -0,0 +1,189 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_FIXED_BASE_POW_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_FIXED_BASE_POW_H_INCLUDED
+
+
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/traits/extensible_make_unsigned.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
+
+namespace hurchalla {
+
+
+// FixedBasePow computes powers of a single base that is fixed at construction,
+// for many different exponents.  It is intended for when you raise the same
+// base (under the same modulus) to a large number of exponents, where calling
+// MontgomeryForm's pow() for each exponent would repeat the same squarings
+// every time.
+//
+// The constructor precomputes a table of base^(d * 2^(TABLE_BITS * j)), for
+// every digit d in [0, 2^TABLE_BITS) and every window position j.  pow() then
+// splits the exponent into TABLE_BITS sized digits and multiplies together
+// one table entry per digit, using no squarings at all.  For an exponent of k
+// bits this is about k/TABLE_BITS multiplies, compared to about k squarings
+// plus k/2 multiplies for MontgomeryForm's pow().
+//
+// TABLE_BITS is the memory/speed tradeoff.  The table holds table_size()
+// MontgomeryValues, which is  ceil(bits(T)/TABLE_BITS) * 2^TABLE_BITS.  For
+// example, with T = uint64_t and a MontgomeryValue of 8 bytes, TABLE_BITS of 4
+// uses 2KB, 6 uses 5.5KB, and 8 uses 16KB.  Larger tables need fewer multiplies
+// per pow(), but cost more to construct and more cache.  The table is stored
+// within the object (there is no heap allocation), so for a large TABLE_BITS
+// you may prefer not to create the object on the stack.
+//
+// MF must be a MontgomeryForm type (i.e. either plain MontgomeryForm, or one of
+// its aliases like MontgomeryQuarter).  The FixedBasePow keeps its own copy of
+// the MontgomeryForm it was given, and every MontgomeryValue it returns belongs
+// to that MontgomeryForm.
+//
+// Example:
+//   hurchalla::MontgomeryForm<uint64_t> mf(modulus);
+//   hurchalla::FixedBasePow<decltype(mf)> fbp(mf, mf.convertIn(base));
+//   uint64_t result = mf.convertOut(fbp.pow(exponent));
+template <class MF, int TABLE_BITS = 4>
+class FixedBasePow final {
+    static_assert(0 < TABLE_BITS && TABLE_BITS <= 10, "FYI you almost "
+        "certainly want 3 <= TABLE_BITS <= 8.  TABLE_BITS above 10 would make "
+        "the table extremely large.");
+ public:
+    using IntegerType = typename MF::IntegerType;
+    using MontgomeryValue = typename MF::MontgomeryValue;
+
+ private:
+    using T = IntegerType;
+    using V = MontgomeryValue;
+    using U = typename extensible_make_unsigned<T>::type;
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+
+    static constexpr int DIGITS = ut_numeric_limits<U>::digits;
+    static constexpr std::size_t TABLE_WIDTH =
+                                   static_cast<std::size_t>(1) << TABLE_BITS;
+    static constexpr std::size_t NUM_WINDOWS =
+               static_cast<std::size_t>((DIGITS + TABLE_BITS - 1) / TABLE_BITS);
+    static constexpr U DIGIT_MASK = static_cast<U>(TABLE_WIDTH - 1);
+
+    // The number of exponents that the batch pow() processes together.  Their
+    // chains of multiplies are independent, which lets the CPU overlap them.
+    static constexpr std::size_t BATCH_CHUNK = 4;
+
+    const MF mf_;
+    // table_[j * TABLE_WIDTH + d] == base^(d * 2^(TABLE_BITS * j))
+    std::array<V, NUM_WINDOWS * TABLE_WIDTH> table_;
+
+ public:
+    // Precomputes the power table for 'base', which must be a value obtained
+    // from 'mf' (or from a MontgomeryForm with the same modulus).
+    FixedBasePow(const MF& mf, MontgomeryValue base) : mf_(mf), table_()
+    {
+        V unity = mf_.getUnityValue();
+        V g = base;
+        for (std::size_t j = 0; j < NUM_WINDOWS; ++j) {
+            V* row = &table_[j * TABLE_WIDTH];
+            row[0] = unity;
+            row[1] = g;
+            for (std::size_t d = 2; d < TABLE_WIDTH; ++d)
+                row[d] = mf_.template multiply<LowlatencyTag>(row[d-1], g);
+            // g = g^(2^TABLE_BITS)
+            g = mf_.template multiply<LowlatencyTag>(row[TABLE_WIDTH-1], g);
+        }
+    }
+
+    // Returns the number of MontgomeryValues stored in the precomputed table.
+    static constexpr std::size_t table_size()
+    {
+        return NUM_WINDOWS * TABLE_WIDTH;
+    }
+
+    // Returns the MontgomeryForm that all of this object's values belong to.
+    const MF& getMontgomeryForm() const { return mf_; }
+
+    // Returns the base (given to the constructor) raised to the power of
+    // 'exponent'.  Requires exponent >= 0.
+    MontgomeryValue pow(T exponent) const
+    {
+        HPBC_CLOCKWORK_API_PRECONDITION(exponent >= 0);
+        U n = static_cast<U>(exponent);
+        V result = table_[static_cast<std::size_t>(n & DIGIT_MASK)];
+        n = shift_digit(n);
+        for (std::size_t j = 1; n != 0; ++j) {
+            HPBC_CLOCKWORK_ASSERT2(j < NUM_WINDOWS);
+            std::size_t d = static_cast<std::size_t>(n & DIGIT_MASK);
+            result = mf_.template multiply<LowlatencyTag>(result,
+                                                  table_[j * TABLE_WIDTH + d]);
+            n = shift_digit(n);
+        }
+        return result;
+    }
+
+    // Batch version of pow().  Sets result[i] to the base raised to the power
+    // of exponents[i], for every i in [0, count).  It processes the exponents
+    // in small groups whose multiplies are independent of each other, and so
+    // it usually has higher throughput than calling pow() for each exponent.
+    // Requires every exponents[i] >= 0.  The arrays must not overlap.
+    void pow(MontgomeryValue* HURCHALLA_RESTRICT result,
+             const T* HURCHALLA_RESTRICT exponents, std::size_t count) const
+    {
+        std::size_t i = 0;
+        for (; count - i >= BATCH_CHUNK; i += BATCH_CHUNK)
+            pow_chunk(result + i, exponents + i);
+        for (; i < count; ++i)
+            result[i] = pow(exponents[i]);
+    }
+
+ private:
+    static HURCHALLA_FORCE_INLINE U shift_digit(U n)
+    {
+        // if TABLE_BITS >= DIGITS, a shift by TABLE_BITS would be undefined
+        // behavior; but then the exponent always fits in a single digit.
+        if HURCHALLA_CPP17_CONSTEXPR (TABLE_BITS >= DIGITS)
+            return 0;
+        else
+            return static_cast<U>(n >> (TABLE_BITS % DIGITS));
+    }
+
+    HURCHALLA_FORCE_INLINE
+    void pow_chunk(V* HURCHALLA_RESTRICT result,
+                   const T* HURCHALLA_RESTRICT exponents) const
+    {
+        std::array<U, BATCH_CHUNK> n;
+        std::array<V, BATCH_CHUNK> acc;
+        U n_max = 0;
+        HURCHALLA_REQUEST_UNROLL_LOOP
+        for (std::size_t k=0; k<BATCH_CHUNK; ++k) {
+            HPBC_CLOCKWORK_API_PRECONDITION(exponents[k] >= 0);
+            n[k] = static_cast<U>(exponents[k]);
+            n_max = static_cast<U>(n_max | n[k]);
+            acc[k] = table_[static_cast<std::size_t>(n[k] & DIGIT_MASK)];
+            n[k] = shift_digit(n[k]);
+        }
+        n_max = shift_digit(n_max);
+        for (std::size_t j = 1; n_max != 0; ++j) {
+            HPBC_CLOCKWORK_ASSERT2(j < NUM_WINDOWS);
+            const V* row = &table_[j * TABLE_WIDTH];
+            HURCHALLA_REQUEST_UNROLL_LOOP
+            for (std::size_t k=0; k<BATCH_CHUNK; ++k) {
+                std::size_t d = static_cast<std::size_t>(n[k] & DIGIT_MASK);
+                acc[k] = mf_.template multiply<LowuopsTag>(acc[k], row[d]);
+                n[k] = shift_digit(n[k]);
+            }
+            n_max = shift_digit(n_max);
+        }
+        HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t k=0; k<BATCH_CHUNK; ++k)
+            result[k] = acc[k];
+    }
+};
+
+
+} // end namespace
+
+#endif
@@ -0,0 +1,321 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_MONTGOMERY_FORM_ARRAY_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_MONTGOMERY_FORM_ARRAY_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/low_level_api/REDC.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/get_R_mod_n.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/inverse_mod_R.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/get_Rsquared_mod_n.h"
+#include "hurchalla/modular_arithmetic/modular_addition.h"
+#include "hurchalla/modular_arithmetic/modular_subtraction.h"
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/traits/extensible_make_unsigned.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/unsigned_multiply_to_hilo_product.h"
+#include "hurchalla/util/count_leading_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
+
+namespace hurchalla {
+
+
+// MontgomeryFormArray performs montgomery arithmetic on NUM_LANES independent
+// lanes, each of which has its own modulus.  Every operation is performed on
+// all lanes at once.  It is intended for when you work with many different
+// moduli in lockstep - for example performing the same computation for each
+// of N candidate primes.
+//
+// Compared to using N separate MontgomeryForm objects, this class stores each
+// of its montgomery constants (the moduli, R mod n, the inverse of n mod R,
+// and R^2 mod n) as a contiguous array, with one element per lane.  Every
+// lane operation is a loop over independent elements of these arrays, which
+// lets the CPU overlap the work of different lanes, and which the compiler
+// can vectorize; the montgomery reductions use the array version of
+// REDC_standard() (see low_level_api/REDC.h), which for some types and
+// instruction sets uses SIMD directly.  The constructor computes the constants
+// for all lanes together, using the same low level functions that
+// MontgomeryForm uses.
+//
+// R is 2^(bit width of T).  Any odd modulus greater than 1 and less than or
+// equal to max_modulus() is allowed, and all montgomery values are kept fully
+// reduced (i.e. each lane of a MontgomeryValue is less than that lane's
+// modulus).  T may be signed or unsigned, but all values given to this class
+// must be nonnegative.
+//
+// Example:
+//   std::array<uint64_t, 8> moduli = ...;
+//   hurchalla::MontgomeryFormArray<uint64_t, 8> mfa(moduli);
+//   auto x = mfa.convertIn(values);
+//   auto y = mfa.pow(x, exponents);
+//   std::array<uint64_t, 8> results = mfa.convertOut(y);
+template <class T, std::size_t NUM_LANES>
+class MontgomeryFormArray final {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(NUM_LANES > 0, "");
+    using U = typename extensible_make_unsigned<T>::type;
+    using UArray = std::array<U, NUM_LANES>;
+
+    UArray n_;
+    UArray r_mod_n_;
+    UArray inv_n_;
+    UArray r_squared_mod_n_;
+
+ public:
+    using IntegerType = T;
+    using LaneArray = std::array<T, NUM_LANES>;
+
+    class MontgomeryValue {
+        friend class MontgomeryFormArray;
+        UArray lane;
+     public:
+        HURCHALLA_FORCE_INLINE MontgomeryValue() = default;
+    };
+
+    // Every modulus must be odd, greater than 1, and less than or equal to
+    // max_modulus().
+    explicit MontgomeryFormArray(const LaneArray& moduli)
+        : n_(), r_mod_n_(), inv_n_(), r_squared_mod_n_()
+    {
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            HPBC_CLOCKWORK_API_PRECONDITION(moduli[i] % 2 == 1);
+            HPBC_CLOCKWORK_API_PRECONDITION(moduli[i] > 1);
+            n_[i] = static_cast<U>(moduli[i]);
+        }
+        for (std::size_t i=0; i<NUM_LANES; ++i)
+            r_mod_n_[i] = ::hurchalla::get_R_mod_n(n_[i]);
+        ::hurchalla::inverse_mod_R(inv_n_.data(), n_.data(), NUM_LANES);
+        r_squared_mod_n_ = ::hurchalla::
+                  get_Rsquared_mod_n<U, NUM_LANES, false, LowuopsTag>(n_,
+                                                             inv_n_, r_mod_n_);
+    }
+    MontgomeryFormArray(const MontgomeryFormArray&) = default;
+    MontgomeryFormArray(MontgomeryFormArray&&) = default;
+
+    static constexpr std::size_t numLanes() { return NUM_LANES; }
+
+    // Returns the largest valid modulus allowed for the constructor.
+    static constexpr T max_modulus()
+    {
+        return (ut_numeric_limits<T>::max() % 2 == 0)
+                    ? static_cast<T>(ut_numeric_limits<T>::max() - 1)
+                    : ut_numeric_limits<T>::max();
+    }
+
+    // Returns the moduli given to the constructor
+    HURCHALLA_FORCE_INLINE LaneArray getModuli() const
+    {
+        LaneArray moduli;
+        for (std::size_t i=0; i<NUM_LANES; ++i)
+            moduli[i] = static_cast<T>(n_[i]);
+        return moduli;
+    }
+
+    // Returns the converted value of every lane of the standard numbers 'a'
+    // into monty form.  Requires a[i] >= 0 for all lanes.  (Note there is no
+    // restriction on how large a[i] can be.)
+    HURCHALLA_FORCE_INLINE MontgomeryValue convertIn(const LaneArray& a) const
+    {
+        // As a precondition, REDC requires  a * r_squared_mod_n < n*R.  This
+        // is always satisfied, since r_squared_mod_n < n and a < R.  See
+        // MontyCommonBase::convertIn() for more details.
+        UArray u_hi, u_lo;
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            HPBC_CLOCKWORK_API_PRECONDITION(a[i] >= 0);
+            u_hi[i] = ::hurchalla::unsigned_multiply_to_hilo_product(u_lo[i],
+                                     static_cast<U>(a[i]), r_squared_mod_n_[i]);
+        }
+        MontgomeryValue result;
+        ::hurchalla::REDC_standard(result.lane.data(), u_hi.data(),
+                   u_lo.data(), n_.data(), inv_n_.data(), NUM_LANES,
+                   LowuopsTag());
+        return result;
+    }
+
+    // Converts every lane of the montgomery value x into a "normal" number,
+    // and returns the results.  Guarantees 0 <= result[i] < modulus[i].
+    HURCHALLA_FORCE_INLINE LaneArray convertOut(const MontgomeryValue& x) const
+    {
+        UArray u_hi, tmp;
+        for (std::size_t i=0; i<NUM_LANES; ++i)
+            u_hi[i] = 0;
+        ::hurchalla::REDC_standard(tmp.data(), u_hi.data(), x.lane.data(),
+                   n_.data(), inv_n_.data(), NUM_LANES, LowuopsTag());
+        LaneArray result;
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            result[i] = static_cast<T>(tmp[i]);
+            HPBC_CLOCKWORK_POSTCONDITION(0 <= result[i] && tmp[i] < n_[i]);
+        }
+        return result;
+    }
+
+    // Returns the montgomery value of 1 in every lane.
+    HURCHALLA_FORCE_INLINE MontgomeryValue getUnityValue() const
+    {
+        MontgomeryValue result;
+        result.lane = r_mod_n_;
+        return result;
+    }
+    // Returns the montgomery value of 0 in every lane.
+    HURCHALLA_FORCE_INLINE MontgomeryValue getZeroValue() const
+    {
+        MontgomeryValue result;
+        for (std::size_t i=0; i<NUM_LANES; ++i)
+            result.lane[i] = 0;
+        return result;
+    }
+
+    // Returns the modular sum x + y for every lane
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue add(const MontgomeryValue& x,
+                        const MontgomeryValue& y) const
+    {
+        MontgomeryValue result;
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            result.lane[i] = ::hurchalla::modular_addition_prereduced_inputs(
+                                               x.lane[i], y.lane[i], n_[i]);
+        }
+        return result;
+    }
+    // Returns the modular difference x - y for every lane
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue subtract(const MontgomeryValue& x,
+                             const MontgomeryValue& y) const
+    {
+        MontgomeryValue result;
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            result.lane[i] = ::hurchalla::modular_subtraction_prereduced_inputs(
+                                               x.lane[i], y.lane[i], n_[i]);
+        }
+        return result;
+    }
+
+    // Returns the modular product x * y for every lane
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue multiply(const MontgomeryValue& x,
+                             const MontgomeryValue& y) const
+    {
+        // Since x < n and y < n, we have u = x*y < n*n < n*R, which satisfies
+        // REDC's precondition.
+        UArray u_hi, u_lo;
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            u_hi[i] = ::hurchalla::unsigned_multiply_to_hilo_product(u_lo[i],
+                                                         x.lane[i], y.lane[i]);
+        }
+        MontgomeryValue result;
+        ::hurchalla::REDC_standard(result.lane.data(), u_hi.data(),
+                   u_lo.data(), n_.data(), inv_n_.data(), NUM_LANES,
+                   LowuopsTag());
+        return result;
+    }
+    // Returns the modular square x * x for every lane
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue square(const MontgomeryValue& x) const
+    {
+        return multiply(x, x);
+    }
+    // "Fused multiply add" operation.  Returns the modular evaluation of
+    // (x * y) + z for every lane.
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue fmadd(const MontgomeryValue& x, const MontgomeryValue& y,
+                          const MontgomeryValue& z) const
+    {
+        return add(multiply(x, y), z);
+    }
+
+    // Returns the modular exponentiation of every lane of 'base' to the power
+    // of that lane's exponent.  Requires exponents[i] >= 0 for all lanes.
+    // The work is proportional to the bit length of the largest exponent.
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue pow(const MontgomeryValue& base,
+                        const LaneArray& exponents) const
+    {
+        UArray e;
+        U maxexp = 0;
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            HPBC_CLOCKWORK_API_PRECONDITION(exponents[i] >= 0);
+            e[i] = static_cast<U>(exponents[i]);
+            maxexp = (maxexp < e[i]) ? e[i] : maxexp;
+        }
+        MontgomeryValue result = getUnityValue();
+        if (maxexp == 0)
+            return result;
+        int numbits = ut_numeric_limits<U>::digits - count_leading_zeros(maxexp);
+        // left-to-right binary exponentiation, selecting per lane whether to
+        // keep the product with the base
+        for (int bit = numbits - 1; bit >= 0; --bit) {
+            result = square(result);
+            MontgomeryValue product = multiply(result, base);
+            for (std::size_t i=0; i<NUM_LANES; ++i) {
+                U mask = static_cast<U>(0 - static_cast<U>((e[i] >> bit) & 1u));
+                result.lane[i] = static_cast<U>((product.lane[i] & mask) |
+                                           (result.lane[i] & ~mask));
+            }
+        }
+        return result;
+    }
+    // Returns the modular exponentiation of every lane of 'base' to the power
+    // of 'exponent'.  Requires exponent >= 0.
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue pow(const MontgomeryValue& base, T exponent) const
+    {
+        HPBC_CLOCKWORK_API_PRECONDITION(exponent >= 0);
+        U e = static_cast<U>(exponent);
+        MontgomeryValue result = getUnityValue();
+        if (e == 0)
+            return result;
+        MontgomeryValue b = base;
+        while (true) {
+            if (e & 1u)
+                result = multiply(result, b);
+            e = static_cast<U>(e >> 1);
+            if (e == 0)
+                break;
+            b = square(b);
+        }
+        return result;
+    }
+
+    // Returns the modular exponentiation of 2 to the power of each lane's
+    // exponent.  Requires exponents[i] >= 0 for all lanes.  This is faster
+    // than calling pow() with a base of 2, since multiplying by 2 is simply a
+    // modular addition.
+    HURCHALLA_FORCE_INLINE
+    MontgomeryValue two_pow(const LaneArray& exponents) const
+    {
+        UArray e;
+        U maxexp = 0;
+        for (std::size_t i=0; i<NUM_LANES; ++i) {
+            HPBC_CLOCKWORK_API_PRECONDITION(exponents[i] >= 0);
+            e[i] = static_cast<U>(exponents[i]);
+            maxexp = (maxexp < e[i]) ? e[i] : maxexp;
+        }
+        MontgomeryValue result = getUnityValue();
+        if (maxexp == 0)
+            return result;
+        int numbits = ut_numeric_limits<U>::digits - count_leading_zeros(maxexp);
+        for (int bit = numbits - 1; bit >= 0; --bit) {
+            result = square(result);
+            MontgomeryValue doubled = add(result, result);
+            for (std::size_t i=0; i<NUM_LANES; ++i) {
+                U mask = static_cast<U>(0 - static_cast<U>((e[i] >> bit) & 1u));
+                result.lane[i] = static_cast<U>((doubled.lane[i] & mask) |
+                                           (result.lane[i] & ~mask));
+            }
+        }
+        return result;
+    }
+};
+
+
+} // end namespace
+
+#endif
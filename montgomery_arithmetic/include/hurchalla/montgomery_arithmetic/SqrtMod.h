@@ -0,0 +1,302 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_SQRT_MOD_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_SQRT_MOD_H_INCLUDED
+
+
+#include "hurchalla/modular_arithmetic/jacobi.h"
+#include "hurchalla/util/traits/extensible_make_unsigned.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/count_leading_zeros.h"
+#include "hurchalla/util/count_trailing_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
+
+namespace hurchalla {
+
+
+// SqrtMod computes square roots modulo a prime p, for many different values
+// under the same modulus.  It is intended for when you need square roots in
+// bulk (for example, to set up the polynomials of a quadratic sieve), where
+// the work that depends only on p would otherwise be repeated for every value.
+//
+// The constructor chooses a method based on p, and precomputes what that
+// method needs:
+//   p == 3 (mod 4):  the root is x^((p+1)/4).
+//   p == 5 (mod 8):  Atkin's method, which needs a single pow.
+//   p == 1 (mod 8):  Tonelli-Shanks.  With p - 1 == q*2^s for odd q, the
+//       constructor finds a quadratic non-residue z and caches z^q.  Each
+//       root then costs one pow plus up to about s*s/2 squarings.
+//   p == 1 (mod 8) with a large s:  when s is so large that Tonelli-Shanks'
+//       s*s/2 term would dominate, we use Cipolla's method instead, whose cost
+//       doesn't depend on s.
+// Every method works entirely on MontgomeryValues, apart from the Jacobi
+// symbols computed while searching for a non-residue.
+//
+// MF must be a MontgomeryForm type (i.e. either plain MontgomeryForm, or one of
+// its aliases like MontgomeryQuarter), and its modulus must be an odd prime.
+// The SqrtMod keeps its own copy of the MontgomeryForm it was given, and the
+// values you pass in and get back belong to that MontgomeryForm.
+//
+// Example:
+//   hurchalla::MontgomeryForm<uint64_t> mf(prime);
+//   hurchalla::SqrtMod<decltype(mf)> sm(mf);
+//   bool isSquare;
+//   auto root = sm.sqrt(mf.convertIn(x), isSquare);
+//   if (isSquare)
+//       uint64_t r = mf.convertOut(root);   // r*r == x (mod prime)
+template <class MF>
+class SqrtMod final {
+ public:
+    using IntegerType = typename MF::IntegerType;
+    using MontgomeryValue = typename MF::MontgomeryValue;
+
+ private:
+    using T = IntegerType;
+    using V = MontgomeryValue;
+    using C = typename MF::CanonicalValue;
+    using U = typename extensible_make_unsigned<T>::type;
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+
+    static constexpr int DIGITS = ut_numeric_limits<U>::digits;
+
+    // The number of values that the batch sqrt() processes together.  The
+    // multiplies of their pows are independent, which lets the CPU overlap
+    // them.
+    static constexpr std::size_t BATCH_CHUNK = 4;
+
+    enum class Method { ThreeMod4, FiveMod8, TonelliShanks, Cipolla };
+
+    const MF mf_;
+    Method method_;
+    // the exponent for the first pow (unused by Cipolla)
+    U exponent_;
+    // for Tonelli-Shanks, p - 1 == q*2^s, and zq_ == z^q for a non-residue z
+    int s_;
+    V zq_;
+
+ public:
+    // Chooses the method for the modulus of mf, which must be an odd prime,
+    // and precomputes the values it needs.
+    explicit SqrtMod(const MF& mf) : mf_(mf), method_(Method::ThreeMod4),
+                                     exponent_(0), s_(0),
+                                     zq_(mf.getUnityValue())
+    {
+        U p = static_cast<U>(mf_.getModulus());
+        HPBC_CLOCKWORK_API_PRECONDITION(p > 2 && p % 2 == 1);
+        if ((p & 3u) == 3) {
+            method_ = Method::ThreeMod4;
+            exponent_ = static_cast<U>((p >> 2) + 1);     // (p+1)/4
+        } else if ((p & 7u) == 5) {
+            method_ = Method::FiveMod8;
+            exponent_ = static_cast<U>(p >> 3);           // (p-5)/8
+        } else {
+            U pm1 = static_cast<U>(p - 1);
+            s_ = count_trailing_zeros(pm1);
+            U q = static_cast<U>(pm1 >> s_);
+            int bits = DIGITS - count_leading_zeros(p);
+            // Beyond its pow, Tonelli-Shanks needs on average about s*s/4
+            // multiplies, whereas Cipolla needs about 5 multiplies per bit of
+            // p instead of a pow.  The crossover measured for 64 bit p was at
+            // about s == 26.
+            if (s_ * s_ > 10 * bits) {
+                method_ = Method::Cipolla;
+            } else {
+                method_ = Method::TonelliShanks;
+                exponent_ = static_cast<U>(q >> 1);       // (q-1)/2
+                // For p == 1 (mod 8), 2 is a quadratic residue, so we start
+                // the search for a non-residue at 3.
+                U z = 3;
+                while (::hurchalla::jacobi(z, p) != -1)
+                    ++z;
+                zq_ = mf_.pow(mf_.convertIn(static_cast<T>(z)),
+                              static_cast<T>(q));
+            }
+        }
+    }
+
+    // Returns the MontgomeryForm that all of this object's values belong to.
+    const MF& getMontgomeryForm() const { return mf_; }
+
+    // Returns a square root of x, i.e. a value r with r*r == x (mod p), and
+    // sets isSquare to true.  If x has no square root (x is a quadratic
+    // non-residue), sets isSquare to false and returns an unspecified value.
+    // Which of the two roots r and -r is returned is unspecified.
+    MontgomeryValue sqrt(MontgomeryValue x, bool& isSquare) const
+    {
+        if (method_ == Method::Cipolla)
+            return cipolla(x, isSquare);
+        V w = (method_ == Method::FiveMod8) ?
+                        mf_.pow(mf_.two_times(x), static_cast<T>(exponent_)) :
+                        mf_.pow(x, static_cast<T>(exponent_));
+        return finish(x, w, isSquare);
+    }
+
+    // Batch version of sqrt().  For every i in [0, count), sets roots[i] to a
+    // square root of x[i] and sets isSquare[i] to true, or if x[i] has no
+    // square root, sets isSquare[i] to false.  It processes the values in
+    // small groups whose pows are computed together, and so it usually has
+    // higher throughput than calling sqrt() for each value.  The arrays must
+    // not overlap.
+    void sqrt(MontgomeryValue* HURCHALLA_RESTRICT roots,
+              bool* HURCHALLA_RESTRICT isSquare,
+              const MontgomeryValue* HURCHALLA_RESTRICT x,
+              std::size_t count) const
+    {
+        std::size_t i = 0;
+        if (method_ != Method::Cipolla) {
+            for (; count - i >= BATCH_CHUNK; i += BATCH_CHUNK) {
+                std::array<V, BATCH_CHUNK> bases;
+                HURCHALLA_REQUEST_UNROLL_LOOP
+                for (std::size_t k=0; k<BATCH_CHUNK; ++k) {
+                    bases[k] = (method_ == Method::FiveMod8) ?
+                                              mf_.two_times(x[i+k]) : x[i+k];
+                }
+                std::array<V, BATCH_CHUNK> w =
+                                  mf_.pow(bases, static_cast<T>(exponent_));
+                HURCHALLA_REQUEST_UNROLL_LOOP
+                for (std::size_t k=0; k<BATCH_CHUNK; ++k)
+                    roots[i+k] = finish(x[i+k], w[k], isSquare[i+k]);
+            }
+        }
+        for (; i < count; ++i) {
+            bool b;
+            roots[i] = sqrt(x[i], b);
+            isSquare[i] = b;
+        }
+    }
+
+ private:
+    // Computes the root from x and w, where w is the result of the first pow,
+    // and checks that its square is x.
+    V finish(V x, V w, bool& isSquare) const
+    {
+        const C cx = mf_.getCanonicalValue(x);
+        V r;
+        if (method_ == Method::ThreeMod4) {
+            r = w;
+        } else if (method_ == Method::FiveMod8) {
+            // w == (2x)^((p-5)/8).  With i = 2x*w^2, which is a square root
+            // of -1 when x is a residue, the root is x*w*(i - 1).
+            V xw = mf_.multiply(x, w);
+            V i = mf_.multiply(mf_.two_times(xw), w);
+            r = mf_.multiply(xw, mf_.subtract(i, mf_.getUnityValue()));
+        } else {
+            HPBC_CLOCKWORK_ASSERT2(method_ == Method::TonelliShanks);
+            if (cx == mf_.getZeroValue()) {
+                isSquare = true;
+                return x;
+            }
+            return tonelli_shanks(x, w, isSquare);
+        }
+        isSquare = (mf_.getCanonicalValue(mf_.square(r)) == cx);
+        return r;
+    }
+
+    // w == x^((q-1)/2).
+    V tonelli_shanks(V x, V w, bool& isSquare) const
+    {
+        const C one = mf_.getUnityValue();
+        V r = mf_.multiply(x, w);       // x^((q+1)/2)
+        V b = mf_.multiply(r, w);       // x^q
+        V c = zq_;
+        int m = s_;
+        // invariant: r*r == x*b, b has order dividing 2^(m-1) if x is a
+        // residue, and c has order 2^m.
+        while (mf_.getCanonicalValue(b) != one) {
+            // find the least i with b^(2^i) == 1
+            int i = 0;
+            V t = b;
+            do {
+                t = mf_.square(t);
+                ++i;
+                if (i == m) {
+                    // b's order is 2^m, so x is a non-residue
+                    isSquare = false;
+                    return r;
+                }
+            } while (mf_.getCanonicalValue(t) != one);
+            for (int j = 0; j < m - i - 1; ++j)
+                c = mf_.square(c);
+            r = mf_.multiply(r, c);
+            c = mf_.square(c);
+            b = mf_.multiply(b, c);
+            m = i;
+        }
+        isSquare = true;
+        return r;
+    }
+
+    // Cipolla's method: find a with a*a - x a non-residue, and let
+    // w = a*a - x.  Then in the field of elements u + v*sqrt(w), the root
+    // is (a + sqrt(w))^((p+1)/2), which has v == 0.
+    V cipolla(V x, bool& isSquare) const
+    {
+        const C cx = mf_.getCanonicalValue(x);
+        if (cx == mf_.getZeroValue()) {
+            isSquare = true;
+            return x;
+        }
+        U p = static_cast<U>(mf_.getModulus());
+        V a = mf_.getUnityValue();
+        V w;
+        for (;;) {
+            w = mf_.subtract(mf_.square(a), x);
+            int j = mf_.jacobi(w);
+            if (j == -1)
+                break;
+            if (j == 0) {
+                isSquare = true;        // a*a == x
+                return a;
+            }
+            a = mf_.add(a, mf_.getUnityValue());
+        }
+        U e = static_cast<U>((p >> 1) + 1);               // (p+1)/2
+        V u = a;
+        V v = mf_.getUnityValue();
+        int shift = DIGITS - 1 - count_leading_zeros(e);
+        for (int k = shift - 1; k >= 0; --k) {
+            // (u + v*sqrt(w))^2 == (u*u + v*v*w) + 2*u*v*sqrt(w)
+            V uu = mf_.square(u);
+            V vv = mf_.square(v);
+            V uv = mf_.multiply(u, v);
+            u = mf_.add(uu, mf_.multiply(vv, w));
+            v = mf_.two_times(uv);
+            if ((e >> k) & 1u) {
+                // (u + v*sqrt(w)) * (a + sqrt(w)) ==
+                //                      (u*a + v*w) + (u + v*a)*sqrt(w)
+                V ua = mf_.multiply(u, a);
+                V vw = mf_.multiply(v, w);
+                v = mf_.add(u, mf_.multiply(v, a));
+                u = mf_.add(ua, vw);
+            }
+        }
+        isSquare = (mf_.getCanonicalValue(mf_.square(u)) == cx);
+        return u;
+    }
+};
+
+
+// Returns a square root of x modulo the modulus of mf, which must be an odd
+// prime, and sets isSquare to true; or if x has no square root, sets isSquare
+// to false and returns an unspecified value.  This is a convenience wrapper
+// for SqrtMod; if you need square roots of many values with the same modulus,
+// construct a SqrtMod once and use it for all the values instead.
+template <class MF>
+typename MF::MontgomeryValue
+sqrt_mod(const MF& mf, typename MF::MontgomeryValue x, bool& isSquare)
+{
+    return SqrtMod<MF>(mf).sqrt(x, isSquare);
+}
+
+
+} // end namespace
+
+#endif
@@ -9,6 +9,7 @@
 #define HURCHALLA_MONTGOMERY_ARITHMETIC_MONTGOMERY_FORM_EXTENSIONS_H_INCLUDED
 
 
+#include "hurchalla/montgomery_arithmetic/detail/MontyCommonBase.h"
 #include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
 #include "hurchalla/util/compiler_macros.h"
@@ -115,6 +116,16 @@ struct MontgomeryFormExtensions final {
     }
 
 
+    // Constructs a MontgomeryForm from montgomery constants that were computed
+    // in advance (make_montgomery_forms() computes them for many moduli at
+    // once).  MontType must be one of the montgomery types that derive from
+    // MontyCommonBase.
+    HURCHALLA_FORCE_INLINE
+    static MF constructFromPrecomputed(const MontyPrecomputedConstants<RU>& pc)
+    {
+        return MF(pc);
+    }
+
     HURCHALLA_FORCE_INLINE
     static SquaringValue getSquaringValue(const MF& mf, MontgomeryValue x)
     {
@@ -13,6 +13,8 @@
 #include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
 #include "hurchalla/modular_arithmetic/modular_multiplication.h"
 #include "hurchalla/modular_arithmetic/modular_multiplicative_inverse.h"
+#include "hurchalla/modular_arithmetic/detail/impl_modular_multiplicative_inverse.h"
+#include "hurchalla/modular_arithmetic/detail/impl_jacobi.h"
 #include "hurchalla/montgomery_arithmetic/low_level_api/get_Rsquared_mod_n.h"
 #include "hurchalla/montgomery_arithmetic/low_level_api/get_R_mod_n.h"
 #include "hurchalla/montgomery_arithmetic/low_level_api/inverse_mod_R.h"
@@ -36,7 +38,21 @@ namespace hurchalla { namespace detail {
 // R = (UP)ut_numeric_limits<T>::max + 1.  As an example if T us uint64_t, then
 // R = (UP)1 << 64.  The name 'R' is based on the wikipedia presentation
 // https://en.wikipedia.org/wiki/Montgomery_modular_multiplication
-//
+
+
+// The montgomery constants for a modulus n, computed in advance.  This lets
+// make_montgomery_forms (see make_montgomery_forms.h) compute the constants
+// for many moduli together, rather than one modulus at a time in each
+// constructor.
+template <typename T>
+struct MontyPrecomputedConstants {
+    T n;                  // the modulus
+    T r_mod_n;            // get_R_mod_n(n)
+    T inv_n;              // inverse_mod_R(n)
+    T r_squared_mod_n;    // get_Rsquared_mod_n(n, inv_n, r_mod_n)
+};
+
+
 // This base class uses the CRTP idiom
 // https://en.wikipedia.org/wiki/Curiously_recurring_template_pattern
 // This is the base class shared by most montgomery forms (the experimental
@@ -75,6 +91,24 @@ class MontyCommonBase {
         HPBC_CLOCKWORK_INVARIANT2(r_squared_mod_n_ < n_);
     }
 
+    explicit MontyCommonBase(const MontyPrecomputedConstants<T>& pc) :
+         n_(pc.n),
+         r_mod_n_(pc.r_mod_n),
+         inv_n_(pc.inv_n),
+         r_squared_mod_n_(pc.r_squared_mod_n)
+    {
+        HPBC_CLOCKWORK_PRECONDITION(n_ % 2 == 1);
+        HPBC_CLOCKWORK_PRECONDITION2(n_ > 1);
+        HPBC_CLOCKWORK_PRECONDITION2(0 < r_mod_n_ && r_mod_n_ < n_);
+        HPBC_CLOCKWORK_PRECONDITION2(r_squared_mod_n_ < n_);
+        HPBC_CLOCKWORK_PRECONDITION3(r_mod_n_ == ::hurchalla::get_R_mod_n(n_));
+        HPBC_CLOCKWORK_PRECONDITION3(inv_n_ == ::hurchalla::inverse_mod_R(n_));
+        HPBC_CLOCKWORK_PRECONDITION3(r_squared_mod_n_ ==
+            ::hurchalla::get_Rsquared_mod_n
+            <T, std::is_same<typename D::MontyTag,TagMontyQuarterrange>::value>
+            (n_,inv_n_,r_mod_n_));
+    }
+
  public:
     HURCHALLA_FORCE_INLINE T getModulus() const { return n_; }
 
@@ -396,6 +430,69 @@ class MontyCommonBase {
 
     template <class PTAG>   // Performance TAG (see optimization_tag_structs.h)
     HURCHALLA_FORCE_INLINE C inverse(V x, PTAG) const
+    {
+        // We compute the inverse directly in the montgomery domain using the
+        // binary "almost inverse", for the same types and platforms where
+        // modular_multiplicative_inverse() would use the binary algorithm.
+        // Elsewhere the extended Euclidean algorithm is faster than the binary
+        // algorithm, by more than the two REDCs that inverse_direct() saves.
+        if HURCHALLA_CPP17_CONSTEXPR
+                    (impl_modular_multiplicative_inverse::prefers_binary<T>())
+            return inverse_direct(x, PTAG());
+        else
+            return inverse_via_standard(x, PTAG());
+    }
+
+ private:
+    template <class PTAG>
+    HURCHALLA_FORCE_INLINE C inverse_direct(V x, PTAG) const
+    {
+        // Given x == a*R, we want a^(-1)*R, which is x^(-1)*R^2.  The binary
+        // "almost inverse" gives us s and k such that x*s == 2^k (mod n), and
+        // thus a^(-1)*R == s * 2^(2*digitsT - k) (mod n).  We do this without
+        // ever leaving the montgomery domain, and without any division.
+
+        namespace hc = ::hurchalla;
+        const D* child = static_cast<const D*>(this);
+        HPBC_CLOCKWORK_PRECONDITION2(child->isValid(x));
+        static constexpr int digitsT = ut_numeric_limits<T>::digits;
+
+        T u = child->getNaturalEquivalence(x);
+        T gcd;  // ignored
+        int k;
+        T s = impl_modular_multiplicative_inverse::call_almost_inverse(
+                                                               u, n_, gcd, k);
+        if (s == 0)
+            return getZeroValue();
+        HPBC_CLOCKWORK_ASSERT2(0 < s && s < n_);
+        // The almost inverse starts with its variables u*v == u*n_ (after
+        // removing any factors of two from u, which it counts in k), and every
+        // time it adds j to k it divides u or v by 2^j, so u*v at least halves
+        // for each increment of k.  Since u*v ends at 1, 2^k <= u*n_ <
+        // 2^(2*digitsT).  And since n_ > 1, it takes at least one step, so
+        // 0 < k < 2*digitsT.
+        int m = 2*digitsT - k;
+        HPBC_CLOCKWORK_ASSERT2(0 < m && m < 2*digitsT);
+
+        // Let power = m (mod digitsT).  Since s < n_, we have s*2^power < n*R,
+        // which satisfies REDC's precondition.  REDC gives us s*2^power*R^(-1),
+        // and each convertIn() multiplies by R.
+        int power = (m < digitsT) ? m : m - digitsT;
+        T u_lo;
+        T u_hi = branchless_shift_left_to_hilo(u_lo, s, power);
+        HPBC_CLOCKWORK_ASSERT2(u_hi < n_);
+        V result = child->montyREDC(u_hi, u_lo, PTAG());
+        result = convertIn(child->getNaturalEquivalence(result), PTAG());
+        if (m >= digitsT)
+            result = convertIn(child->getNaturalEquivalence(result), PTAG());
+
+        C cresult = child->getCanonicalValue(result);
+        HPBC_CLOCKWORK_POSTCONDITION2(cresult.get() < n_);
+        return cresult;
+    }
+
+    template <class PTAG>
+    HURCHALLA_FORCE_INLINE C inverse_via_standard(V x, PTAG) const
     {
         // Given x == a*R, we do 2 REDCs to get a*R^(-1), then we call
         // the standard integer domain inverse() to get a^(-1)*R.
@@ -425,7 +522,7 @@ class MontyCommonBase {
         return C(inv);
     }
 
-
+ public:
     // Returns the greatest common divisor of the standard representations
     // (non-montgomery) of both x and the modulus, using the supplied functor.
     // The functor must take two integral arguments of the same type and return
@@ -483,6 +580,25 @@ class MontyCommonBase {
         return p;
     }
 
+    // Returns the Jacobi symbol (c/n_), where c is the standard representation
+    // (non-montgomery) of x, i.e. c == convertOut(x).
+    HURCHALLA_FORCE_INLINE int jacobi(V x) const
+    {
+        // Let g = getNaturalEquivalence(x), and c = convertOut(x).  As shown
+        // for gcd_with_modulus(), g ≡ c*R (mod n_), and so by multiplicativity
+        // of the Jacobi symbol, (g/n_) == (c/n_)*(R/n_).  R is an even power of
+        // 2, and so (R/n_) == (2/n_)^2 == 1.  Therefore (g/n_) == (c/n_), and
+        // we can skip the REDC that convertOut would need.
+        static_assert(ut_numeric_limits<T>::digits % 2 == 0, "");
+        T g = static_cast<const D*>(this)->getNaturalEquivalence(x);
+        // getNaturalEquivalence returns a value less than 2*n_, which we
+        // reduce to avoid a division within impl_jacobi.
+        if (g >= n_)
+            g = static_cast<T>(g - n_);
+        HPBC_CLOCKWORK_ASSERT2(g < n_);
+        return impl_jacobi::call(g, n_);
+    }
+
 
 
     // returns (R*R) mod N
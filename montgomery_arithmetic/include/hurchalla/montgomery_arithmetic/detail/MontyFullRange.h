@@ -133,6 +133,7 @@ class MontyFullRange final :
     using squaringvalue_type = SV;
 
     explicit MontyFullRange(T modulus) : BC(modulus) {}
+    explicit MontyFullRange(const MontyPrecomputedConstants<T>& pc) : BC(pc) {}
 
     static HURCHALLA_FORCE_INLINE constexpr T max_modulus()
     {
@@ -160,6 +160,13 @@ class MontyHalfRange final :
                                        (ut_numeric_limits<T>::digits - 1));
         HPBC_CLOCKWORK_PRECONDITION2(modulus < Rdiv2);
     }
+    explicit MontyHalfRange(const MontyPrecomputedConstants<T>& pc) : BC(pc)
+    {
+        // MontyHalfRange requires  modulus < R/2
+        constexpr T Rdiv2 = static_cast<T>(static_cast<T>(1) <<
+                                       (ut_numeric_limits<T>::digits - 1));
+        HPBC_CLOCKWORK_PRECONDITION2(pc.n < Rdiv2);
+    }
 
     static HURCHALLA_FORCE_INLINE constexpr T max_modulus()
     {
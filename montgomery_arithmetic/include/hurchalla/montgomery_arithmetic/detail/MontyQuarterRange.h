@@ -149,6 +149,13 @@ class MontyQuarterRange final : public
                                        (ut_numeric_limits<T>::digits - 2));
         HPBC_CLOCKWORK_PRECONDITION2(modulus < Rdiv4);
     }
+    explicit MontyQuarterRange(const MontyPrecomputedConstants<T>& pc) : BC(pc)
+    {
+        // MontyQuarterRange requires  modulus < R/4
+        constexpr T Rdiv4 = static_cast<T>(static_cast<T>(1) <<
+                                       (ut_numeric_limits<T>::digits - 2));
+        HPBC_CLOCKWORK_PRECONDITION2(pc.n < Rdiv4);
+    }
 
     static HURCHALLA_FORCE_INLINE constexpr T max_modulus()
     {
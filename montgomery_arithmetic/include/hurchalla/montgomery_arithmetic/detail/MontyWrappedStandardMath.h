@@ -17,6 +17,7 @@
 #include "hurchalla/modular_arithmetic/modular_addition.h"
 #include "hurchalla/modular_arithmetic/modular_subtraction.h"
 #include "hurchalla/modular_arithmetic/absolute_value_difference.h"
+#include "hurchalla/modular_arithmetic/jacobi.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
 #include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
 #include "hurchalla/util/cselect_on_bit.h"
@@ -371,6 +372,16 @@ class MontyWrappedStandardMath final {
         return p;
     }
 
+    // Returns the Jacobi symbol (c/modulus_), where c == convertOut(x).
+    // Unlike the other functions of this class, this requires an odd modulus.
+    HURCHALLA_FORCE_INLINE int jacobi(V x) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(modulus_ % 2 == 1);
+        // x.get() == convertOut(x), as described in gcd_with_modulus().
+        HPBC_CLOCKWORK_PRECONDITION2(x.get() < modulus_);
+        return ::hurchalla::jacobi(x.get(), modulus_);
+    }
+
     // This class doesn't do anything special for square functions.
     // It just delegates to the functions above.
     // --------
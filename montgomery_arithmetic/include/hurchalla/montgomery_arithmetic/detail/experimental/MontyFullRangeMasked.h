@@ -202,6 +202,7 @@ class MontyFullRangeMasked final :
     using squaringvalue_type = SV;
 
     explicit MontyFullRangeMasked(T modulus) : BC(modulus) {}
+    explicit MontyFullRangeMasked(const MontyPrecomputedConstants<T>& pc) : BC(pc) {}
 
     static HURCHALLA_FORCE_INLINE constexpr T max_modulus()
     {
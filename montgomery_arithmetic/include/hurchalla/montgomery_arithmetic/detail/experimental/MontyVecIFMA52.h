@@ -0,0 +1,595 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_MONTY_VEC_IFMA52_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_MONTY_VEC_IFMA52_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/low_level_api/inverse_mod_R.h"
+#include "hurchalla/modular_arithmetic/modular_multiplication.h"
+#include "hurchalla/util/unsigned_multiply_to_hilo_product.h"
+#include "hurchalla/util/count_leading_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstdint>
+#include <array>
+
+// The vector code path requires a compiler that targets AVX-512F and
+// AVX-512 IFMA (for example with -mavx512f -mavx512ifma, or -march=native on
+// a CPU that has these extensions).  Otherwise we use the portable scalar code
+// path, which produces identical results one lane at a time.  You can force
+// the scalar path by defining HURCHALLA_DISALLOW_AVX512_IFMA.
+#if defined(__AVX512F__) && defined(__AVX512IFMA__) && \
+    !defined(HURCHALLA_DISALLOW_AVX512_IFMA)
+#  define HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512 1
+#  include <immintrin.h>
+#endif
+
+
+namespace hurchalla { namespace detail {
+
+
+// MontyVecIFMA52 performs montgomery arithmetic on 8 independent lanes at
+// once, where each lane has its own modulus (you may of course use the same
+// modulus in every lane, if you have 8 values to process for one modulus).
+// It is designed around the AVX-512 IFMA instructions vpmadd52luq/vpmadd52huq,
+// which multiply the low 52 bits of each 64 bit lane and produce either the
+// low or the high 52 bits of the 104 bit product.  Accordingly we use the
+// montgomery constant R = 1 << 52 (rather than 1 << 64), and we use the same
+// "quarterrange" algorithms as MontyQuarterRange: each modulus must be odd and
+// less than R/4 == 1 << 50, and montgomery values are kept in the range
+// 0 <= x < 2*n.  See MontyQuarterRange.h for the theory.
+//
+// This class provides the multiply, square, fmadd, fmsub, add, subtract
+// surface of MontyQuarterRange, except that every function operates on all 8
+// lanes.  It can not be used as the MontyType of MontgomeryForm, since
+// MontgomeryForm's API is scalar.
+//
+// When the compiler does not target IFMA, the class uses a portable scalar
+// implementation.  It is usually better to use MontgomeryQuarter<std::uint64_t>
+// in that situation.  The code path is chosen at compile time, and there is no
+// run-time dispatch: a program compiled to target IFMA will fail with an
+// illegal instruction on a CPU that lacks IFMA.
+
+class MontyVecIFMA52 final {
+ public:
+    using uint_type = std::uint64_t;
+    static constexpr int LANES = 8;
+    using lane_array = std::array<std::uint64_t, LANES>;
+
+ private:
+    static constexpr int Rbits = 52;
+    static constexpr std::uint64_t Rmask = (static_cast<std::uint64_t>(1) << Rbits) - 1;
+
+    struct alignas(64) Lanes {
+        std::uint64_t lane[LANES];
+    };
+
+ public:
+    // regular montgomery value type
+    class V {
+     protected:
+        Lanes val;
+        friend class MontyVecIFMA52;
+     public:
+        HURCHALLA_FORCE_INLINE V() = default;
+    };
+    // canonical montgomery value type
+    class C : public V {
+        friend class MontyVecIFMA52;
+     public:
+        HURCHALLA_FORCE_INLINE C() = default;
+        HURCHALLA_FORCE_INLINE friend bool operator==(const C& x, const C& y)
+        {
+            for (int i=0; i<LANES; ++i) {
+                if (x.val.lane[i] != y.val.lane[i])
+                    return false;
+            }
+            return true;
+        }
+        HURCHALLA_FORCE_INLINE friend bool operator!=(const C& x, const C& y)
+            { return !(x == y); }
+    };
+    // fusing montgomery value (addend/subtrahend for fmadd/fmsub)
+    class FV : public V {
+        friend class MontyVecIFMA52;
+     public:
+        HURCHALLA_FORCE_INLINE FV() = default;
+    };
+
+    using montvalue_type = V;
+    using canonvalue_type = C;
+    using fusingvalue_type = FV;
+
+ private:
+    Lanes n_;
+    Lanes n2_;        // 2*n_
+    Lanes inv_n_;     // n_^(-1) mod R
+    Lanes r_mod_n_;
+    Lanes r_squared_mod_n_;
+
+    void initLane(int i, std::uint64_t modulus)
+    {
+        HPBC_CLOCKWORK_PRECONDITION(modulus % 2 == 1);
+        HPBC_CLOCKWORK_PRECONDITION(1 < modulus && modulus <= max_modulus());
+        namespace hc = ::hurchalla;
+        n_.lane[i] = modulus;
+        n2_.lane[i] = 2*modulus;
+        inv_n_.lane[i] = hc::inverse_mod_R(modulus) & Rmask;
+        std::uint64_t rmodn = (static_cast<std::uint64_t>(1) << Rbits) % modulus;
+        r_mod_n_.lane[i] = rmodn;
+        r_squared_mod_n_.lane[i] =
+            hc::modular_multiplication_prereduced_inputs(rmodn, rmodn, modulus);
+        HPBC_CLOCKWORK_POSTCONDITION2(
+                      ((modulus * inv_n_.lane[i]) & Rmask) == 1);
+        HPBC_CLOCKWORK_POSTCONDITION2(0 < rmodn && rmodn < modulus);
+    }
+
+ public:
+    // Each modulus must be odd, and must satisfy 1 < modulus < (1 << 50).
+    explicit MontyVecIFMA52(const lane_array& moduli)
+        : n_(), n2_(), inv_n_(), r_mod_n_(), r_squared_mod_n_()
+    {
+        for (int i=0; i<LANES; ++i)
+            initLane(i, moduli[static_cast<std::size_t>(i)]);
+    }
+    // Uses the same modulus for all lanes.
+    explicit MontyVecIFMA52(std::uint64_t modulus)
+        : n_(), n2_(), inv_n_(), r_mod_n_(), r_squared_mod_n_()
+    {
+        for (int i=0; i<LANES; ++i)
+            initLane(i, modulus);
+    }
+
+    static HURCHALLA_FORCE_INLINE constexpr std::uint64_t max_modulus()
+    {
+        return (static_cast<std::uint64_t>(1) << (Rbits - 2)) - 1;
+    }
+
+    HURCHALLA_FORCE_INLINE lane_array getModulus() const
+    {
+        return toArray(n_);
+    }
+
+    // Each input a[i] must satisfy a[i] < (1 << 52).
+    HURCHALLA_FORCE_INLINE V convertIn(const lane_array& a) const
+    {
+        V x;
+        for (int i=0; i<LANES; ++i) {
+            x.val.lane[i] = a[static_cast<std::size_t>(i)];
+            HPBC_CLOCKWORK_PRECONDITION2(x.val.lane[i] <= Rmask);
+        }
+        // since a < R and r_squared_mod_n < n, a*r_squared_mod_n < n*R,
+        // satisfying the REDC precondition.
+        return mulREDC(x.val, r_squared_mod_n_);
+    }
+
+    HURCHALLA_FORCE_INLINE lane_array convertOut(V x) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(x));
+        Lanes result;
+#ifdef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+        __m512i vx = _mm512_load_si512(x.val.lane);
+        __m512i vn = _mm512_load_si512(n_.lane);
+        __m512i vinv = _mm512_load_si512(inv_n_.lane);
+        __m512i zero = _mm512_setzero_si512();
+        // u_hi == 0 and u_lo == x, so REDC gives 0 - mn_hi (mod n).
+        __m512i m = _mm512_madd52lo_epu64(zero, vx, vinv);
+        __m512i mn_hi = _mm512_madd52hi_epu64(zero, m, vn);
+        __m512i t = _mm512_sub_epi64(vn, mn_hi);
+        t = _mm512_min_epu64(t, _mm512_sub_epi64(t, vn));
+        _mm512_store_si512(result.lane, t);
+#else
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t m = (x.val.lane[i] * inv_n_.lane[i]) & Rmask;
+            std::uint64_t mn_lo;
+            std::uint64_t mn_hi = mulHi52(mn_lo, m, n_.lane[i]);
+            std::uint64_t t = n_.lane[i] - mn_hi;
+            result.lane[i] = (t == n_.lane[i]) ? 0 : t;
+        }
+#endif
+        for (int i=0; i<LANES; ++i)
+            HPBC_CLOCKWORK_POSTCONDITION2(result.lane[i] < n_.lane[i]);
+        return toArray(result);
+    }
+
+    HURCHALLA_FORCE_INLINE C getUnityValue() const
+    {
+        C c;
+        c.val = r_mod_n_;
+        return c;
+    }
+    HURCHALLA_FORCE_INLINE C getZeroValue() const
+    {
+        C c;
+        for (int i=0; i<LANES; ++i)
+            c.val.lane[i] = 0;
+        return c;
+    }
+    HURCHALLA_FORCE_INLINE C getNegativeOneValue() const
+    {
+        C c;
+        for (int i=0; i<LANES; ++i)
+            c.val.lane[i] = n_.lane[i] - r_mod_n_.lane[i];
+        return c;
+    }
+
+    HURCHALLA_FORCE_INLINE C getCanonicalValue(V x) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(x));
+        C c;
+        c.val = minSubtracted(x.val, n_);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(c));
+        return c;
+    }
+    // Internal to this class, FV and C are interchangeable (as is the case for
+    // MontyQuarterRange).
+    HURCHALLA_FORCE_INLINE FV getFusingValue(V x) const
+    {
+        FV fv;
+        fv.val = getCanonicalValue(x).val;
+        return fv;
+    }
+
+    HURCHALLA_FORCE_INLINE V add(V x, V y) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(y));
+        V result;
+        result.val = addMod(x.val, y.val, n2_);
+        HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE C add(C cx, C cy) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(cx));
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(cy));
+        C result;
+        result.val = addMod(cx.val, cy.val, n_);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+        return result;
+    }
+
+    HURCHALLA_FORCE_INLINE V subtract(V x, V y) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(y));
+        V result;
+        result.val = subtractMod(x.val, y.val, n2_);
+        HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE C subtract(C cx, C cy) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(cx));
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(cy));
+        C result;
+        result.val = subtractMod(cx.val, cy.val, n_);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+        return result;
+    }
+
+    HURCHALLA_FORCE_INLINE V negate(V x) const
+    {
+        return subtract(getZeroValue(), x);
+    }
+
+    HURCHALLA_FORCE_INLINE V multiply(V x, V y) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(y));
+        // Since x < 2*n and y < 2*n and n < R/4, we know x*y < n*R, as
+        // required for REDC.
+        V result = mulREDC(x.val, y.val);
+        HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE V square(V x) const
+    {
+        return multiply(x, x);
+    }
+
+    // Multiplies x and y, and then adds canonical value z to the product.
+    // As in MontyCommonBase::fmadd(), we add z to the high half of the product
+    // prior to REDC, so that the addition can execute in parallel with the
+    // REDC multiplies.
+    HURCHALLA_FORCE_INLINE V fmadd(V x, V y, C z) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(y));
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(z));
+        V result = fusedREDC<true>(x.val, y.val, z.val);
+        HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE V fmadd(V x, V y, FV fv) const
+    {
+        C z;
+        z.val = fv.val;
+        return fmadd(x, y, z);
+    }
+    // Multiplies x and y, and then subtracts canonical value z from the
+    // product.
+    HURCHALLA_FORCE_INLINE V fmsub(V x, V y, C z) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isValid(y));
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(z));
+        V result = fusedREDC<false>(x.val, y.val, z.val);
+        HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE V fmsub(V x, V y, FV fv) const
+    {
+        C z;
+        z.val = fv.val;
+        return fmsub(x, y, z);
+    }
+
+    // Returns 2^exponents[i] (in montgomery form) for every lane i, using a
+    // lane-parallel version of the table-free array algorithm in
+    // impl_montgomery_two_pow.h.  The loop is bounded by the largest exponent.
+    // See MontyVecU32::two_pow() for an explanation of the method; here we
+    // have R == 2^52 rather than 2^32, and so for each full window of P2 bits
+    // we multiply by 2^(idx + 52 - 32) rather than by 2^idx.  This multiplier
+    // is at most 2^51, and since every value is less than 2*n, the REDC
+    // precondition x*y < n*R is always satisfied.
+    HURCHALLA_FORCE_INLINE V two_pow(const lane_array& exponents) const
+    {
+        constexpr int P2 = 5;
+        constexpr std::uint64_t MASK = (1u << P2) - 1u;
+        constexpr std::uint64_t ADJUST = Rbits - (1u << P2);
+        std::uint64_t maxexp = 0;
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t e = exponents[static_cast<std::size_t>(i)];
+            maxexp = (maxexp < e) ? e : maxexp;
+        }
+        Lanes y;
+        if (maxexp <= MASK) {
+            for (int i=0; i<LANES; ++i) {
+                std::uint64_t e = exponents[static_cast<std::size_t>(i)];
+                y.lane[i] = static_cast<std::uint64_t>(1) << e;
+            }
+            V result = mulREDC(r_squared_mod_n_, y);
+            HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+            return result;
+        }
+
+        namespace hc = ::hurchalla;
+        int numbits = 64 - hc::count_leading_zeros(maxexp);
+        int shift = numbits - P2;
+        HPBC_CLOCKWORK_ASSERT2(shift > 0);
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t idx = exponents[static_cast<std::size_t>(i)] >> shift;
+            HPBC_CLOCKWORK_ASSERT2(idx <= MASK);
+            y.lane[i] = static_cast<std::uint64_t>(1) << idx;
+        }
+        V result = mulREDC(r_squared_mod_n_, y);
+        result = add(result, result);
+
+        while (shift >= P2) {
+            for (int j=0; j<P2; ++j)
+                result = square(result);
+            shift -= P2;
+            for (int i=0; i<LANES; ++i) {
+                std::uint64_t idx =
+                      (exponents[static_cast<std::size_t>(i)] >> shift) & MASK;
+                y.lane[i] = static_cast<std::uint64_t>(1) << (idx + ADJUST);
+            }
+            result = mulREDC(result.val, y);
+            if (shift == 0) {
+                HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+                return result;
+            }
+            result = add(result, result);
+        }
+
+        HPBC_CLOCKWORK_ASSERT2(0 < shift && shift < P2);
+        for (int j=0; j<shift; ++j)
+            result = square(result);
+        std::uint64_t tailmask = (static_cast<std::uint64_t>(1) << shift) - 1;
+        std::uint64_t tail_adjust =
+                           static_cast<std::uint64_t>(Rbits - (1 << shift));
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t idx = exponents[static_cast<std::size_t>(i)] & tailmask;
+            y.lane[i] = static_cast<std::uint64_t>(1) << (idx + tail_adjust);
+        }
+        result = mulREDC(result.val, y);
+        HPBC_CLOCKWORK_POSTCONDITION2(isValid(result));
+        return result;
+    }
+
+ private:
+    static HURCHALLA_FORCE_INLINE lane_array toArray(const Lanes& a)
+    {
+        lane_array arr;
+        for (int i=0; i<LANES; ++i)
+            arr[static_cast<std::size_t>(i)] = a.lane[i];
+        return arr;
+    }
+
+    HURCHALLA_FORCE_INLINE bool isValid(V x) const
+    {
+        for (int i=0; i<LANES; ++i) {
+            if (x.val.lane[i] >= n2_.lane[i])
+                return false;
+        }
+        return true;
+    }
+    HURCHALLA_FORCE_INLINE bool isCanonical(V x) const
+    {
+        for (int i=0; i<LANES; ++i) {
+            if (x.val.lane[i] >= n_.lane[i])
+                return false;
+        }
+        return true;
+    }
+
+#ifndef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+    // Returns the high 52 bits of the (up to) 104 bit product a*b, and writes
+    // the low 52 bits of the product to lo.  Requires a < 2^52 and b < 2^52.
+    static HURCHALLA_FORCE_INLINE
+    std::uint64_t mulHi52(std::uint64_t& lo, std::uint64_t a, std::uint64_t b)
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(a <= Rmask && b <= Rmask);
+        namespace hc = ::hurchalla;
+        std::uint64_t lo64;
+        std::uint64_t hi64 = hc::unsigned_multiply_to_hilo_product(lo64, a, b);
+        lo = lo64 & Rmask;
+        return (hi64 << (64 - Rbits)) | (lo64 >> Rbits);
+    }
+#endif
+
+    // returns for each lane,  (a < b) ? a : a - b
+    static HURCHALLA_FORCE_INLINE Lanes minSubtracted(const Lanes& a,
+                                                      const Lanes& b)
+    {
+        Lanes result;
+#ifdef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+        __m512i va = _mm512_load_si512(a.lane);
+        __m512i vb = _mm512_load_si512(b.lane);
+        // when a < b, a - b wraps around to a huge value, so min selects a.
+        __m512i r = _mm512_min_epu64(va, _mm512_sub_epi64(va, vb));
+        _mm512_store_si512(result.lane, r);
+#else
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t diff = a.lane[i] - b.lane[i];
+            result.lane[i] = (a.lane[i] < b.lane[i]) ? a.lane[i] : diff;
+        }
+#endif
+        return result;
+    }
+
+    // for each lane, requires x < mod and y < mod and mod < 2^63
+    static HURCHALLA_FORCE_INLINE
+    Lanes addMod(const Lanes& x, const Lanes& y, const Lanes& mod)
+    {
+        Lanes sum;
+#ifdef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+        __m512i s = _mm512_add_epi64(_mm512_load_si512(x.lane),
+                                     _mm512_load_si512(y.lane));
+        _mm512_store_si512(sum.lane, s);
+#else
+        for (int i=0; i<LANES; ++i)
+            sum.lane[i] = x.lane[i] + y.lane[i];
+#endif
+        return minSubtracted(sum, mod);
+    }
+
+    // for each lane, requires x < mod and y < mod and mod < 2^63
+    static HURCHALLA_FORCE_INLINE
+    Lanes subtractMod(const Lanes& x, const Lanes& y, const Lanes& mod)
+    {
+        Lanes result;
+#ifdef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+        __m512i d = _mm512_sub_epi64(_mm512_load_si512(x.lane),
+                                     _mm512_load_si512(y.lane));
+        // when x < y, d wraps around to a huge value while d + mod is the
+        // correct result.  Otherwise d is correct and d + mod is larger.
+        __m512i r = _mm512_min_epu64(d,
+                            _mm512_add_epi64(d, _mm512_load_si512(mod.lane)));
+        _mm512_store_si512(result.lane, r);
+#else
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t diff = x.lane[i] - y.lane[i];
+            result.lane[i] = (x.lane[i] < y.lane[i]) ? diff + mod.lane[i] : diff;
+        }
+#endif
+        return result;
+    }
+
+    // For each lane, computes REDC(x*y) in the quarterrange style:
+    // returns a value congruent to x*y*R^(-1) (mod n), in the range [0, 2*n).
+    // Requires x*y < n*R, and x,y < R.
+    HURCHALLA_FORCE_INLINE V mulREDC(const Lanes& x, const Lanes& y) const
+    {
+        V result;
+#ifdef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+        __m512i vx = _mm512_load_si512(x.lane);
+        __m512i vy = _mm512_load_si512(y.lane);
+        __m512i vn = _mm512_load_si512(n_.lane);
+        __m512i zero = _mm512_setzero_si512();
+        __m512i u_lo = _mm512_madd52lo_epu64(zero, vx, vy);
+        // we fold the "+ n" of the quarterrange REDC into the accumulator
+        __m512i u_hi_plus_n = _mm512_madd52hi_epu64(vn, vx, vy);
+        __m512i m = _mm512_madd52lo_epu64(zero, u_lo,
+                                          _mm512_load_si512(inv_n_.lane));
+        __m512i mn_hi = _mm512_madd52hi_epu64(zero, m, vn);
+        __m512i r = _mm512_sub_epi64(u_hi_plus_n, mn_hi);
+        _mm512_store_si512(result.val.lane, r);
+#else
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t u_lo;
+            std::uint64_t u_hi = mulHi52(u_lo, x.lane[i], y.lane[i]);
+            HPBC_CLOCKWORK_ASSERT2(u_hi < n_.lane[i]);
+            std::uint64_t m = (u_lo * inv_n_.lane[i]) & Rmask;
+            std::uint64_t mn_lo;
+            std::uint64_t mn_hi = mulHi52(mn_lo, m, n_.lane[i]);
+            HPBC_CLOCKWORK_ASSERT2(mn_lo == u_lo);
+            result.val.lane[i] = (u_hi + n_.lane[i]) - mn_hi;
+        }
+#endif
+        return result;
+    }
+
+    // For each lane, computes REDC(x*y + z*R) if IS_ADD, or REDC(x*y - z*R)
+    // otherwise, where the high half of the product is reduced modulo n after
+    // the addition/subtraction of z.  See MontyCommonBase::fmadd() for proof.
+    template <bool IS_ADD> HURCHALLA_FORCE_INLINE
+    V fusedREDC(const Lanes& x, const Lanes& y, const Lanes& z) const
+    {
+        V result;
+#ifdef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+        __m512i vx = _mm512_load_si512(x.lane);
+        __m512i vy = _mm512_load_si512(y.lane);
+        __m512i vz = _mm512_load_si512(z.lane);
+        __m512i vn = _mm512_load_si512(n_.lane);
+        __m512i zero = _mm512_setzero_si512();
+        __m512i u_lo = _mm512_madd52lo_epu64(zero, vx, vy);
+        __m512i u_hi = _mm512_madd52hi_epu64(zero, vx, vy);
+        __m512i m = _mm512_madd52lo_epu64(zero, u_lo,
+                                          _mm512_load_si512(inv_n_.lane));
+        __m512i v_hi;
+        if (IS_ADD) {
+            v_hi = _mm512_add_epi64(u_hi, vz);
+            v_hi = _mm512_min_epu64(v_hi, _mm512_sub_epi64(v_hi, vn));
+        } else {
+            v_hi = _mm512_sub_epi64(u_hi, vz);
+            v_hi = _mm512_min_epu64(v_hi, _mm512_add_epi64(v_hi, vn));
+        }
+        __m512i mn_hi = _mm512_madd52hi_epu64(zero, m, vn);
+        __m512i r = _mm512_sub_epi64(_mm512_add_epi64(v_hi, vn), mn_hi);
+        _mm512_store_si512(result.val.lane, r);
+#else
+        for (int i=0; i<LANES; ++i) {
+            std::uint64_t n = n_.lane[i];
+            std::uint64_t u_lo;
+            std::uint64_t u_hi = mulHi52(u_lo, x.lane[i], y.lane[i]);
+            HPBC_CLOCKWORK_ASSERT2(u_hi < n);
+            std::uint64_t v_hi;
+            if (IS_ADD) {
+                v_hi = u_hi + z.lane[i];
+                v_hi = (v_hi >= n) ? v_hi - n : v_hi;
+            } else {
+                v_hi = u_hi - z.lane[i];
+                v_hi = (u_hi < z.lane[i]) ? v_hi + n : v_hi;
+            }
+            HPBC_CLOCKWORK_ASSERT2(v_hi < n);
+            std::uint64_t m = (u_lo * inv_n_.lane[i]) & Rmask;
+            std::uint64_t mn_lo;
+            std::uint64_t mn_hi = mulHi52(mn_lo, m, n);
+            result.val.lane[i] = (v_hi + n) - mn_hi;
+        }
+#endif
+        return result;
+    }
+};
+
+
+}} // end namespace
+
+#endif
@@ -0,0 +1,594 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_MONTY_VEC_U32_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_MONTY_VEC_U32_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/low_level_api/inverse_mod_R.h"
+#include "hurchalla/util/count_leading_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+// When the compiler targets AVX2 (e.g. -mavx2 or -march=native), we process
+// 8 lanes per instruction using _mm256_mul_epu32, and when it targets
+// AVX-512F we process 16 lanes per instruction using _mm512_mul_epu32.
+// Otherwise we use a portable scalar code path, which gives identical results.
+// You can define HURCHALLA_DISALLOW_AVX512F and/or HURCHALLA_DISALLOW_AVX2 to
+// prevent use of those instruction sets here.
+#if defined(__AVX512F__) && !defined(HURCHALLA_DISALLOW_AVX512F)
+#  define HURCHALLA_MONTY_VEC_U32_USES_AVX512 1
+#endif
+#if defined(__AVX2__) && !defined(HURCHALLA_DISALLOW_AVX2)
+#  define HURCHALLA_MONTY_VEC_U32_USES_AVX2 1
+#endif
+#if defined(HURCHALLA_MONTY_VEC_U32_USES_AVX512) || \
+    defined(HURCHALLA_MONTY_VEC_U32_USES_AVX2)
+#  include <immintrin.h>
+#endif
+
+
+namespace hurchalla { namespace detail {
+
+
+// The montgomery kernels used by MontyVecU32, each of which processes BLOCK
+// consecutive lanes of 32 bit values.  All pointers must be aligned to at
+// least 4*BLOCK bytes.  R == 1 << 32, and all values are canonical (i.e. they
+// are less than their lane's modulus n).
+template <std::size_t BLOCK> struct vec_u32_kernel;
+
+template <> struct vec_u32_kernel<1> {
+    // REDC(x*y): standard montgomery multiplication, with a fully reduced
+    // result.  Any odd n < R is allowed, since x*y < n*n < n*R.
+    static HURCHALLA_FORCE_INLINE
+    void mulREDC(std::uint32_t* HURCHALLA_RESTRICT out,
+                 const std::uint32_t* x, const std::uint32_t* y,
+                 const std::uint32_t* n, const std::uint32_t* inv_n)
+    {
+        std::uint64_t u = static_cast<std::uint64_t>(*x) * (*y);
+        std::uint32_t m = static_cast<std::uint32_t>(u) * (*inv_n);
+        std::uint64_t mn = static_cast<std::uint64_t>(m) * (*n);
+        std::uint32_t u_hi = static_cast<std::uint32_t>(u >> 32);
+        std::uint32_t mn_hi = static_cast<std::uint32_t>(mn >> 32);
+        std::uint32_t diff = static_cast<std::uint32_t>(u_hi - mn_hi);
+        *out = (u_hi < mn_hi) ? static_cast<std::uint32_t>(diff + *n) : diff;
+    }
+    static HURCHALLA_FORCE_INLINE
+    void addmod(std::uint32_t* HURCHALLA_RESTRICT out,
+                const std::uint32_t* x, const std::uint32_t* y,
+                const std::uint32_t* n)
+    {
+        std::uint32_t tmp = static_cast<std::uint32_t>(*n - *y);
+        std::uint32_t diff = static_cast<std::uint32_t>(*x - tmp);
+        *out = (*x < tmp) ? static_cast<std::uint32_t>(diff + *n) : diff;
+    }
+    static HURCHALLA_FORCE_INLINE
+    void submod(std::uint32_t* HURCHALLA_RESTRICT out,
+                const std::uint32_t* x, const std::uint32_t* y,
+                const std::uint32_t* n)
+    {
+        std::uint32_t diff = static_cast<std::uint32_t>(*x - *y);
+        *out = (*x < *y) ? static_cast<std::uint32_t>(diff + *n) : diff;
+    }
+};
+
+#ifdef HURCHALLA_MONTY_VEC_U32_USES_AVX2
+template <> struct vec_u32_kernel<8> {
+    // The Lanes arrays are 64 byte aligned.  Casting through void* avoids
+    // -Wcast-align, which can't see that.
+    static HURCHALLA_FORCE_INLINE __m256i load(const std::uint32_t* p)
+    {
+        return _mm256_load_si256(
+                 static_cast<const __m256i*>(static_cast<const void*>(p)));
+    }
+    static HURCHALLA_FORCE_INLINE void store(std::uint32_t* p, __m256i v)
+    {
+        _mm256_store_si256(static_cast<__m256i*>(static_cast<void*>(p)), v);
+    }
+
+    // _mm256_mul_epu32 multiplies only the even numbered 32 bit lanes, so we
+    // perform the REDC separately for the even and odd lanes, and then blend.
+    static HURCHALLA_FORCE_INLINE
+    void mulREDC(std::uint32_t* HURCHALLA_RESTRICT out,
+                 const std::uint32_t* x, const std::uint32_t* y,
+                 const std::uint32_t* n, const std::uint32_t* inv_n)
+    {
+        __m256i vx = load(x);
+        __m256i vy = load(y);
+        __m256i vn = load(n);
+        __m256i vinv = load(inv_n);
+
+        __m256i p_even = _mm256_mul_epu32(vx, vy);
+        __m256i p_odd = _mm256_mul_epu32(_mm256_srli_epi64(vx, 32),
+                                         _mm256_srli_epi64(vy, 32));
+        __m256i m_even = _mm256_mul_epu32(p_even, vinv);
+        __m256i m_odd = _mm256_mul_epu32(p_odd, _mm256_srli_epi64(vinv, 32));
+        __m256i mn_even = _mm256_mul_epu32(m_even, vn);
+        __m256i mn_odd = _mm256_mul_epu32(m_odd, _mm256_srli_epi64(vn, 32));
+
+        __m256i u_hi = _mm256_blend_epi32(_mm256_srli_epi64(p_even, 32),
+                                          p_odd, 0xAA);
+        __m256i mn_hi = _mm256_blend_epi32(_mm256_srli_epi64(mn_even, 32),
+                                           mn_odd, 0xAA);
+        __m256i diff = _mm256_sub_epi32(u_hi, mn_hi);
+        // no borrow occurred in a lane iff u_hi >= mn_hi in that lane
+        __m256i noborrow = _mm256_cmpeq_epi32(_mm256_max_epu32(u_hi, mn_hi),
+                                              u_hi);
+        __m256i r = _mm256_add_epi32(diff, _mm256_andnot_si256(noborrow, vn));
+        store(out, r);
+    }
+    static HURCHALLA_FORCE_INLINE
+    void addmod(std::uint32_t* HURCHALLA_RESTRICT out,
+                const std::uint32_t* x, const std::uint32_t* y,
+                const std::uint32_t* n)
+    {
+        __m256i vx = load(x);
+        __m256i vy = load(y);
+        __m256i vn = load(n);
+        __m256i tmp = _mm256_sub_epi32(vn, vy);
+        __m256i diff = _mm256_sub_epi32(vx, tmp);
+        __m256i noborrow = _mm256_cmpeq_epi32(_mm256_max_epu32(vx, tmp), vx);
+        __m256i r = _mm256_add_epi32(diff, _mm256_andnot_si256(noborrow, vn));
+        store(out, r);
+    }
+    static HURCHALLA_FORCE_INLINE
+    void submod(std::uint32_t* HURCHALLA_RESTRICT out,
+                const std::uint32_t* x, const std::uint32_t* y,
+                const std::uint32_t* n)
+    {
+        __m256i vx = load(x);
+        __m256i vy = load(y);
+        __m256i vn = load(n);
+        __m256i diff = _mm256_sub_epi32(vx, vy);
+        __m256i noborrow = _mm256_cmpeq_epi32(_mm256_max_epu32(vx, vy), vx);
+        __m256i r = _mm256_add_epi32(diff, _mm256_andnot_si256(noborrow, vn));
+        store(out, r);
+    }
+};
+#endif
+
+#ifdef HURCHALLA_MONTY_VEC_U32_USES_AVX512
+template <> struct vec_u32_kernel<16> {
+    // see vec_u32_kernel<8> for the approach
+    static HURCHALLA_FORCE_INLINE
+    void mulREDC(std::uint32_t* HURCHALLA_RESTRICT out,
+                 const std::uint32_t* x, const std::uint32_t* y,
+                 const std::uint32_t* n, const std::uint32_t* inv_n)
+    {
+        __m512i vx = _mm512_load_si512(x);
+        __m512i vy = _mm512_load_si512(y);
+        __m512i vn = _mm512_load_si512(n);
+        __m512i vinv = _mm512_load_si512(inv_n);
+
+        __m512i p_even = _mm512_mul_epu32(vx, vy);
+        __m512i p_odd = _mm512_mul_epu32(_mm512_srli_epi64(vx, 32),
+                                         _mm512_srli_epi64(vy, 32));
+        __m512i m_even = _mm512_mul_epu32(p_even, vinv);
+        __m512i m_odd = _mm512_mul_epu32(p_odd, _mm512_srli_epi64(vinv, 32));
+        __m512i mn_even = _mm512_mul_epu32(m_even, vn);
+        __m512i mn_odd = _mm512_mul_epu32(m_odd, _mm512_srli_epi64(vn, 32));
+
+        __m512i u_hi = _mm512_mask_blend_epi32(static_cast<__mmask16>(0xAAAA),
+                                      _mm512_srli_epi64(p_even, 32), p_odd);
+        __m512i mn_hi = _mm512_mask_blend_epi32(static_cast<__mmask16>(0xAAAA),
+                                      _mm512_srli_epi64(mn_even, 32), mn_odd);
+        __m512i diff = _mm512_sub_epi32(u_hi, mn_hi);
+        __mmask16 borrow = _mm512_cmplt_epu32_mask(u_hi, mn_hi);
+        __m512i r = _mm512_mask_add_epi32(diff, borrow, diff, vn);
+        _mm512_store_si512(out, r);
+    }
+    static HURCHALLA_FORCE_INLINE
+    void addmod(std::uint32_t* HURCHALLA_RESTRICT out,
+                const std::uint32_t* x, const std::uint32_t* y,
+                const std::uint32_t* n)
+    {
+        __m512i vx = _mm512_load_si512(x);
+        __m512i vn = _mm512_load_si512(n);
+        __m512i tmp = _mm512_sub_epi32(vn, _mm512_load_si512(y));
+        __m512i diff = _mm512_sub_epi32(vx, tmp);
+        __mmask16 borrow = _mm512_cmplt_epu32_mask(vx, tmp);
+        _mm512_store_si512(out, _mm512_mask_add_epi32(diff, borrow, diff, vn));
+    }
+    static HURCHALLA_FORCE_INLINE
+    void submod(std::uint32_t* HURCHALLA_RESTRICT out,
+                const std::uint32_t* x, const std::uint32_t* y,
+                const std::uint32_t* n)
+    {
+        __m512i vx = _mm512_load_si512(x);
+        __m512i vy = _mm512_load_si512(y);
+        __m512i vn = _mm512_load_si512(n);
+        __m512i diff = _mm512_sub_epi32(vx, vy);
+        __mmask16 borrow = _mm512_cmplt_epu32_mask(vx, vy);
+        _mm512_store_si512(out, _mm512_mask_add_epi32(diff, borrow, diff, vn));
+    }
+};
+#endif
+
+
+// MontyVecU32 performs montgomery arithmetic on LANES independent 32 bit lanes
+// at once, where each lane has its own modulus (or you can use the same
+// modulus for all lanes).  LANES may be 8 or 16.  Any odd modulus n with
+// 1 < n < (1 << 32) is allowed, and all montgomery values are kept fully
+// reduced (canonical), using R = 1 << 32.
+//
+// For T == uint32_t on x86-64, MontgomeryForm<T> maps to
+// MontyQuarterRange<uint64_t>, which performs one 64 bit scalar REDC per
+// operation.  MontyVecU32 instead performs 8 (AVX2) or 16 (AVX-512) 32 bit
+// REDCs per vector instruction sequence, which can give much higher
+// throughput when you have many independent values or moduli to process.
+// Since MontgomeryForm's API is scalar, this class is used directly rather
+// than as a MontyType for MontgomeryForm.
+template <std::size_t LANES = 8>
+class MontyVecU32 final {
+    static_assert(LANES == 8 || LANES == 16, "");
+    // The AVX-512 kernel handles exactly 16 lanes, so an 8 lane MontyVecU32
+    // uses the AVX2 kernel if it is available, or else the scalar kernel.
+#if defined(HURCHALLA_MONTY_VEC_U32_USES_AVX512) && \
+    defined(HURCHALLA_MONTY_VEC_U32_USES_AVX2)
+    static constexpr std::size_t BLOCK = (LANES == 16) ? 16 : 8;
+#elif defined(HURCHALLA_MONTY_VEC_U32_USES_AVX512)
+    static constexpr std::size_t BLOCK = (LANES == 16) ? 16 : 1;
+#elif defined(HURCHALLA_MONTY_VEC_U32_USES_AVX2)
+    static constexpr std::size_t BLOCK = 8;
+#else
+    static constexpr std::size_t BLOCK = 1;
+#endif
+    using K = vec_u32_kernel<BLOCK>;
+
+    struct alignas(64) Lanes {
+        std::uint32_t lane[LANES];
+    };
+ public:
+    using uint_type = std::uint32_t;
+    static constexpr std::size_t NUM_LANES = LANES;
+    using lane_array = std::array<std::uint32_t, LANES>;
+
+    class V {
+        Lanes val;
+        friend class MontyVecU32;
+     public:
+        HURCHALLA_FORCE_INLINE V() = default;
+        HURCHALLA_FORCE_INLINE friend bool operator==(const V& x, const V& y)
+        {
+            for (std::size_t i=0; i<LANES; ++i) {
+                if (x.val.lane[i] != y.val.lane[i])
+                    return false;
+            }
+            return true;
+        }
+        HURCHALLA_FORCE_INLINE friend bool operator!=(const V& x, const V& y)
+            { return !(x == y); }
+    };
+    // All values are canonical, so there is no separate canonical value type.
+    using montvalue_type = V;
+    using canonvalue_type = V;
+
+ private:
+    Lanes n_;
+    Lanes inv_n_;     // n_^(-1) mod R
+    Lanes r_mod_n_;
+    Lanes r_squared_mod_n_;
+    Lanes one_;       // every lane == 1
+
+    void initLane(std::size_t i, std::uint32_t modulus)
+    {
+        HPBC_CLOCKWORK_PRECONDITION(modulus % 2 == 1);
+        HPBC_CLOCKWORK_PRECONDITION(modulus > 1);
+        n_.lane[i] = modulus;
+        inv_n_.lane[i] = ::hurchalla::inverse_mod_R(modulus);
+        std::uint64_t R = static_cast<std::uint64_t>(1) << 32;
+        std::uint64_t rmodn = R % modulus;
+        r_mod_n_.lane[i] = static_cast<std::uint32_t>(rmodn);
+        r_squared_mod_n_.lane[i] =
+                           static_cast<std::uint32_t>((rmodn * rmodn) % modulus);
+        one_.lane[i] = 1;
+        HPBC_CLOCKWORK_POSTCONDITION2(
+                  static_cast<std::uint32_t>(modulus * inv_n_.lane[i]) == 1);
+    }
+
+    HURCHALLA_FORCE_INLINE V mulREDC(const Lanes& x, const Lanes& y) const
+    {
+        V result;
+        for (std::size_t i=0; i<LANES; i+=BLOCK)
+            K::mulREDC(&result.val.lane[i], &x.lane[i], &y.lane[i],
+                       &n_.lane[i], &inv_n_.lane[i]);
+        return result;
+    }
+
+    HURCHALLA_FORCE_INLINE bool isCanonical(const V& x) const
+    {
+        for (std::size_t i=0; i<LANES; ++i) {
+            if (x.val.lane[i] >= n_.lane[i])
+                return false;
+        }
+        return true;
+    }
+
+ public:
+    // Each modulus must be odd and greater than 1.
+    explicit MontyVecU32(const lane_array& moduli)
+        : n_(), inv_n_(), r_mod_n_(), r_squared_mod_n_(), one_()
+    {
+        for (std::size_t i=0; i<LANES; ++i)
+            initLane(i, moduli[i]);
+    }
+    // Uses the same modulus for all lanes.
+    explicit MontyVecU32(std::uint32_t modulus)
+        : n_(), inv_n_(), r_mod_n_(), r_squared_mod_n_(), one_()
+    {
+        for (std::size_t i=0; i<LANES; ++i)
+            initLane(i, modulus);
+    }
+
+    static HURCHALLA_FORCE_INLINE constexpr std::uint32_t max_modulus()
+    {
+        return static_cast<std::uint32_t>(0xFFFFFFFF);
+    }
+
+    HURCHALLA_FORCE_INLINE lane_array getModulus() const
+    {
+        lane_array arr;
+        for (std::size_t i=0; i<LANES; ++i)
+            arr[i] = n_.lane[i];
+        return arr;
+    }
+
+    HURCHALLA_FORCE_INLINE V convertIn(const lane_array& a) const
+    {
+        Lanes x;
+        for (std::size_t i=0; i<LANES; ++i)
+            x.lane[i] = a[i];
+        // Since a < R and r_squared_mod_n < n, a*r_squared_mod_n < n*R,
+        // satisfying the REDC precondition.
+        V result = mulREDC(x, r_squared_mod_n_);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+        return result;
+    }
+
+    HURCHALLA_FORCE_INLINE lane_array convertOut(V x) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(x));
+        // REDC(x*1) == x*R^(-1) (mod n)
+        V y = mulREDC(x.val, one_);
+        lane_array arr;
+        for (std::size_t i=0; i<LANES; ++i)
+            arr[i] = y.val.lane[i];
+        return arr;
+    }
+
+    HURCHALLA_FORCE_INLINE V getUnityValue() const
+    {
+        V v;
+        v.val = r_mod_n_;
+        return v;
+    }
+    HURCHALLA_FORCE_INLINE V getZeroValue() const
+    {
+        V v;
+        for (std::size_t i=0; i<LANES; ++i)
+            v.val.lane[i] = 0;
+        return v;
+    }
+    HURCHALLA_FORCE_INLINE V getNegativeOneValue() const
+    {
+        V v;
+        for (std::size_t i=0; i<LANES; ++i)
+            v.val.lane[i] = n_.lane[i] - r_mod_n_.lane[i];
+        return v;
+    }
+    HURCHALLA_FORCE_INLINE V getCanonicalValue(V x) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(x));
+        return x;
+    }
+
+    HURCHALLA_FORCE_INLINE V add(V x, V y) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(y));
+        V result;
+        for (std::size_t i=0; i<LANES; i+=BLOCK)
+            K::addmod(&result.val.lane[i], &x.val.lane[i], &y.val.lane[i],
+                      &n_.lane[i]);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE V subtract(V x, V y) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(y));
+        V result;
+        for (std::size_t i=0; i<LANES; i+=BLOCK)
+            K::submod(&result.val.lane[i], &x.val.lane[i], &y.val.lane[i],
+                      &n_.lane[i]);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE V negate(V x) const
+    {
+        return subtract(getZeroValue(), x);
+    }
+
+    HURCHALLA_FORCE_INLINE V multiply(V x, V y) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(x));
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(y));
+        // x*y < n*n < n*R, as required by REDC.
+        V result = mulREDC(x.val, y.val);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+        return result;
+    }
+    HURCHALLA_FORCE_INLINE V square(V x) const
+    {
+        return multiply(x, x);
+    }
+    HURCHALLA_FORCE_INLINE V fmadd(V x, V y, V z) const
+    {
+        return add(multiply(x, y), z);
+    }
+    HURCHALLA_FORCE_INLINE V fmsub(V x, V y, V z) const
+    {
+        return subtract(multiply(x, y), z);
+    }
+
+    // Returns base^exponent (in montgomery form) for every lane, using the
+    // same exponent for all lanes.
+    HURCHALLA_FORCE_INLINE V pow(V base, std::uint64_t exponent) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(base));
+        V result = getUnityValue();
+        while (exponent > 0) {
+            if (exponent & 1u)
+                result = multiply(result, base);
+            exponent = exponent >> 1;
+            base = square(base);
+        }
+        return result;
+    }
+
+    // Returns base[i]^exponents[i] (in montgomery form) for every lane i.  The
+    // loop runs until the largest exponent has been consumed; in each
+    // iteration every lane computes the multiply, and then each lane keeps or
+    // discards the product according to its exponent bit.
+    HURCHALLA_FORCE_INLINE
+    V pow(V base, const std::array<std::uint64_t, LANES>& exponents) const
+    {
+        HPBC_CLOCKWORK_PRECONDITION2(isCanonical(base));
+        std::uint64_t maxexp = 0;
+        for (std::size_t i=0; i<LANES; ++i) {
+            std::uint64_t e = exponents[i];
+            maxexp = (maxexp < e) ? e : maxexp;
+        }
+        V result = getUnityValue();
+        for (int shift = 0; (maxexp >> shift) != 0; ++shift) {
+            V product = multiply(result, base);
+            for (std::size_t i=0; i<LANES; ++i) {
+                std::uint32_t mask = static_cast<std::uint32_t>(0) -
+                    static_cast<std::uint32_t>(
+                        (exponents[i] >> shift) & 1u);
+                result.val.lane[i] = (product.val.lane[i] & mask) |
+                                     (result.val.lane[i] & ~mask);
+            }
+            // 64 is the maximum bit width of an exponent
+            if (shift == 63)
+                break;
+            base = square(base);
+        }
+        return result;
+    }
+
+    // Returns 2^exponents[i] (in montgomery form) for every lane i.  This is a
+    // lane-parallel version of the table-free array algorithm in
+    // impl_montgomery_two_pow.h (arraycall), and it is intended for uses such
+    // as a base 2 fermat test, where we compute 2^(n[i]-1) mod n[i] for many
+    // moduli n[i] at once.  The loop is bounded by the largest exponent.
+    //
+    // We process the exponents in windows of P2 == 5 bits (2^P2 == 32 == the
+    // bit width of R).  For a window with index 'idx', rather than multiplying
+    // by a table entry we multiply by the plain integer 2^idx (which is
+    // computed per lane by a shift), since REDC(x * 2^idx) is the montgomery
+    // form of (X * 2^idx)/R, where X is the value that x represents.  To
+    // cancel the extra factor of 1/R, we double the result after every
+    // window but the last: after the next P2 squarings, that factor of 2
+    // becomes 2^32 == R.
+    HURCHALLA_FORCE_INLINE
+    V two_pow(const std::array<std::uint64_t, LANES>& exponents) const
+    {
+        constexpr int P2 = 5;
+        constexpr std::uint64_t MASK = (1u << P2) - 1u;
+        std::uint64_t maxexp = 0;
+        for (std::size_t i=0; i<LANES; ++i) {
+            std::uint64_t e = exponents[i];
+            maxexp = (maxexp < e) ? e : maxexp;
+        }
+        Lanes y;
+        if (maxexp <= MASK) {
+            // REDC(R*R * 2^e) == R * 2^e, which is the montgomery form of 2^e
+            for (std::size_t i=0; i<LANES; ++i)
+                y.lane[i] = static_cast<std::uint32_t>(1) << exponents[i];
+            V result = mulREDC(r_squared_mod_n_, y);
+            HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+            return result;
+        }
+
+        int numbits = 64 - count_leading_zeros(maxexp);
+        int shift = numbits - P2;
+        HPBC_CLOCKWORK_ASSERT2(shift > 0);
+        for (std::size_t i=0; i<LANES; ++i) {
+            std::uint64_t idx = exponents[i] >> shift;
+            HPBC_CLOCKWORK_ASSERT2(idx <= MASK);
+            y.lane[i] = static_cast<std::uint32_t>(1) << idx;
+        }
+        V result = mulREDC(r_squared_mod_n_, y);
+        result = add(result, result);
+
+        while (shift >= P2) {
+            for (int j=0; j<P2; ++j)
+                result = square(result);
+            shift -= P2;
+            for (std::size_t i=0; i<LANES; ++i) {
+                std::uint64_t idx = (exponents[i] >> shift) & MASK;
+                y.lane[i] = static_cast<std::uint32_t>(1) << idx;
+            }
+            result = mulREDC(result.val, y);
+            if (shift == 0) {
+                HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+                return result;
+            }
+            result = add(result, result);
+        }
+
+        // For the final (partial) window of 'shift' bits, the factor of 2
+        // from the prior window becomes 2^(2^shift) after the squarings, and
+        // so we multiply by 2^(idx + 32 - 2^shift) to obtain a factor of R.
+        HPBC_CLOCKWORK_ASSERT2(0 < shift && shift < P2);
+        for (int j=0; j<shift; ++j)
+            result = square(result);
+        std::uint64_t tailmask = (static_cast<std::uint64_t>(1) << shift) - 1;
+        int adjust = 32 - (1 << shift);
+        for (std::size_t i=0; i<LANES; ++i) {
+            std::uint64_t idx = exponents[i] & tailmask;
+            y.lane[i] = static_cast<std::uint32_t>(1) << (idx +
+                                          static_cast<std::uint64_t>(adjust));
+        }
+        result = mulREDC(result.val, y);
+        HPBC_CLOCKWORK_POSTCONDITION2(isCanonical(result));
+        return result;
+    }
+
+    // Array-of-values entry points, which take and return ordinary
+    // (non-montgomery) values.  The results are fully reduced modulo each
+    // lane's modulus.
+    HURCHALLA_FORCE_INLINE
+    lane_array multiply(const lane_array& a, const lane_array& b) const
+    {
+        return convertOut(multiply(convertIn(a), convertIn(b)));
+    }
+    HURCHALLA_FORCE_INLINE lane_array square(const lane_array& a) const
+    {
+        return convertOut(square(convertIn(a)));
+    }
+    HURCHALLA_FORCE_INLINE
+    lane_array pow(const lane_array& bases, std::uint64_t exponent) const
+    {
+        return convertOut(pow(convertIn(bases), exponent));
+    }
+    HURCHALLA_FORCE_INLINE
+    lane_array pow(const lane_array& bases,
+                   const std::array<std::uint64_t, LANES>& exponents) const
+    {
+        return convertOut(pow(convertIn(bases), exponents));
+    }
+};
+
+
+}} // end namespace
+
+#endif
@@ -0,0 +1,170 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Benchmarks the array versions of REDC_standard and REDC_incomplete (from
+// low_level_api/REDC.h) against a loop that calls the single value versions,
+// for uint32_t, uint64_t, and __uint128_t (when available), and checks that
+// both produce identical results.
+
+#include "hurchalla/montgomery_arithmetic/low_level_api/REDC.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/inverse_mod_R.h"
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+
+#if defined(HURCHALLA_CLOCKWORK_ENABLE_ASSERTS) || defined(HURCHALLA_UTIL_ENABLE_ASSERTS)
+#  warning "asserts are enabled and will slow performance"
+#endif
+
+
+// The arrays are small enough to stay in L1 cache, so that we measure the
+// REDC computations rather than memory bandwidth.
+constexpr std::size_t ARRAY_LEN = 512;
+constexpr int REPETITIONS = 20000;
+
+
+template <typename T>
+T random_T(std::mt19937_64& gen)
+{
+    constexpr int digits = hurchalla::ut_numeric_limits<T>::digits;
+    // the conditional avoids a (harmless) shift count warning for small T
+    constexpr int shift = (digits > 64) ? 64 : 0;
+    T val = static_cast<T>(gen());
+    for (int bits = 64; bits < digits; bits += 64)
+        val = static_cast<T>((val << shift) | static_cast<T>(gen()));
+    return val;
+}
+
+
+template <typename T, class PTAG>
+bool bench(const std::string& name, std::mt19937_64& gen)
+{
+    namespace hc = ::hurchalla;
+    using std::size_t;
+    std::vector<T> u_hi(ARRAY_LEN), u_lo(ARRAY_LEN), n(ARRAY_LEN),
+                   inv_n(ARRAY_LEN), result1(ARRAY_LEN), result2(ARRAY_LEN);
+    for (size_t i=0; i<ARRAY_LEN; ++i) {
+        n[i] = static_cast<T>(random_T<T>(gen) | 1u);
+        if (n[i] == 1)
+            n[i] = 3;
+        inv_n[i] = hc::inverse_mod_R(n[i]);
+        u_hi[i] = static_cast<T>(random_T<T>(gen) % n[i]);
+        u_lo[i] = random_T<T>(gen);
+    }
+
+    using namespace std::chrono;
+    T dummy = 0;  // prevents the compiler from optimizing away the work
+    double ops = static_cast<double>(ARRAY_LEN) * REPETITIONS;
+
+    // Between repetitions we alter u_lo, so that the REDCs can't be hoisted
+    // out of the repetition loop.
+    auto t0 = steady_clock::now();
+    for (int rep=0; rep<REPETITIONS; ++rep) {
+        for (size_t i=0; i<ARRAY_LEN; ++i)
+            result1[i] = hc::REDC_standard(u_hi[i], u_lo[i], n[i], inv_n[i],
+                                           PTAG());
+        dummy = static_cast<T>(dummy + result1[static_cast<size_t>(rep) % ARRAY_LEN]);
+        u_lo[static_cast<size_t>(rep) % ARRAY_LEN] += 1;
+    }
+    auto t1 = steady_clock::now();
+    for (int rep=0; rep<REPETITIONS; ++rep) {
+        hc::REDC_standard(result2.data(), u_hi.data(), u_lo.data(), n.data(),
+                          inv_n.data(), ARRAY_LEN, PTAG());
+        dummy = static_cast<T>(dummy + result2[static_cast<size_t>(rep) % ARRAY_LEN]);
+        u_lo[static_cast<size_t>(rep) % ARRAY_LEN] -= 1;
+    }
+    auto t2 = steady_clock::now();
+    for (int rep=0; rep<REPETITIONS; ++rep) {
+        for (size_t i=0; i<ARRAY_LEN; ++i)
+            result1[i] = hc::REDC_incomplete(u_hi[i], u_lo[i], n[i], inv_n[i],
+                                             PTAG());
+        dummy = static_cast<T>(dummy + result1[static_cast<size_t>(rep) % ARRAY_LEN]);
+        u_lo[static_cast<size_t>(rep) % ARRAY_LEN] += 1;
+    }
+    auto t3 = steady_clock::now();
+    for (int rep=0; rep<REPETITIONS; ++rep) {
+        hc::REDC_incomplete(result2.data(), u_hi.data(), u_lo.data(),
+                            n.data(), inv_n.data(), ARRAY_LEN, PTAG());
+        dummy = static_cast<T>(dummy + result2[static_cast<size_t>(rep) % ARRAY_LEN]);
+        u_lo[static_cast<size_t>(rep) % ARRAY_LEN] -= 1;
+    }
+    auto t4 = steady_clock::now();
+
+    std::cout << name << "\n";
+    std::cout << "  REDC_standard   loop: "
+              << (ops / duration<double>(t1 - t0).count()) / 1e6
+              << " million/sec,  array: "
+              << (ops / duration<double>(t2 - t1).count()) / 1e6
+              << " million/sec\n";
+    std::cout << "  REDC_incomplete loop: "
+              << (ops / duration<double>(t3 - t2).count()) / 1e6
+              << " million/sec,  array: "
+              << (ops / duration<double>(t4 - t3).count()) / 1e6
+              << " million/sec\n";
+
+    // verify that the array and loop versions agree
+    hc::REDC_standard(result2.data(), u_hi.data(), u_lo.data(), n.data(),
+                      inv_n.data(), ARRAY_LEN, PTAG());
+    for (size_t i=0; i<ARRAY_LEN; ++i) {
+        if (result2[i] != hc::REDC_standard(u_hi[i], u_lo[i], n[i], inv_n[i],
+                                            PTAG())) {
+            std::cout << "bug in array REDC_standard found\n";
+            return false;
+        }
+    }
+    hc::REDC_incomplete(result2.data(), u_hi.data(), u_lo.data(), n.data(),
+                        inv_n.data(), ARRAY_LEN, PTAG());
+    for (size_t i=0; i<ARRAY_LEN; ++i) {
+        if (result2[i] != hc::REDC_incomplete(u_hi[i], u_lo[i], n[i], inv_n[i],
+                                              PTAG())) {
+            std::cout << "bug in array REDC_incomplete found\n";
+            return false;
+        }
+    }
+    std::cout << "  ignore: " << static_cast<unsigned int>(dummy) << "\n";
+    return true;
+}
+
+
+int main(int argc, char** argv)
+{
+    std::cout << "---Running Program---\n";
+
+    unsigned int randomization_seed = 1;
+    if (argc > 1)
+        randomization_seed = static_cast<unsigned int>(std::stoul(argv[1]));
+    std::mt19937_64 gen(randomization_seed);
+
+#ifdef HURCHALLA_ARRAY_REDC_USES_AVX512
+    std::cout << "array REDC is using the AVX-512F kernel for uint64_t\n";
+#else
+    std::cout << "array REDC is using the portable code path\n";
+#endif
+    std::cout << std::fixed;
+    std::cout.precision(1);
+
+    namespace hc = ::hurchalla;
+    bool ok = true;
+    ok = ok && bench<std::uint32_t, hc::LowuopsTag>("uint32_t LowuopsTag", gen);
+    ok = ok && bench<std::uint32_t, hc::LowlatencyTag>("uint32_t LowlatencyTag", gen);
+    ok = ok && bench<std::uint64_t, hc::LowuopsTag>("uint64_t LowuopsTag", gen);
+    ok = ok && bench<std::uint64_t, hc::LowlatencyTag>("uint64_t LowlatencyTag", gen);
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    ok = ok && bench<__uint128_t, hc::LowuopsTag>("__uint128_t LowuopsTag", gen);
+    ok = ok && bench<__uint128_t, hc::LowlatencyTag>("__uint128_t LowlatencyTag", gen);
+#endif
+    return ok ? 0 : 1;
+}
@@ -62,6 +62,12 @@ array_montgomery_two_pow(const std::array<MF, ARRAY_SIZE>& mf, const std::array<
     // MontgomeryForm, and at that time the SIMD MontgomeryForm will become the
     // preferred API to use to access the (high throughput) array version of
     // Montgomery two_pow.
+    // In the meantime, the experimental classes MontyVecU32 and MontyVecIFMA52
+    // (in this directory) hold their moduli in SIMD registers, and provide a
+    // member function two_pow(exponents) that runs this same table-free array
+    // algorithm lane-parallel.  If your moduli fit those classes (less than
+    // 2^32 or 2^50 respectively), two_pow() of those classes will usually
+    // have much higher throughput than this function.
 
     return hurchalla::detail::montgomery_two_pow::call(mf, n);
 }
@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Measures the throughput (in candidates/sec) of BatchPrpFilter on a stream of
+// random odd candidates with mixed bit lengths, for several values of LANES.
+// For comparison it also measures testing the candidates one at a time, and
+// testing them in arrays of consecutive candidates without bucketing them by
+// bit length (so that the lanes of an array have mixed bit lengths).  All
+// methods must find the same number of survivors.
+
+#include "hurchalla/montgomery_arithmetic/BatchPrpFilter.h"
+#include "hurchalla/montgomery_arithmetic/detail/impl_batch_prp_filter.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <array>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+
+#if defined(HURCHALLA_CLOCKWORK_ENABLE_ASSERTS) || defined(HURCHALLA_UTIL_ENABLE_ASSERTS)
+#  warning "asserts are enabled and will slow performance"
+#endif
+
+
+constexpr std::size_t NUM_CANDIDATES = 200000;
+
+
+// returns a random odd number with a bit length chosen uniformly from
+// [min_bits, digits(T)]
+template <typename T>
+T random_candidate(std::mt19937_64& gen, int min_bits)
+{
+    constexpr int digits = hurchalla::ut_numeric_limits<T>::digits;
+    // the conditional avoids a (harmless) shift count warning for small T
+    constexpr int shift = (digits > 64) ? 64 : 0;
+    T val = static_cast<T>(gen());
+    for (int bits = 64; bits < digits; bits += 64)
+        val = static_cast<T>((val << shift) | static_cast<T>(gen()));
+    int len = min_bits + static_cast<int>(gen() %
+                                 static_cast<unsigned int>(digits - min_bits + 1));
+    if (len < digits) {
+        T one = 1;
+        val = static_cast<T>(val & static_cast<T>((one << len) - 1));
+        val = static_cast<T>(val | static_cast<T>(one << (len - 1)));
+    } else {
+        val = static_cast<T>(val | static_cast<T>(static_cast<T>(1) << (digits - 1)));
+    }
+    return static_cast<T>(val | 1u);
+}
+
+
+template <typename T, std::size_t LANES>
+std::size_t filter_unbucketed(const std::vector<T>& candidates)
+{
+    namespace hc = ::hurchalla;
+    using MF = hc::MontgomeryFull<T>;
+    std::size_t survivors = 0;
+    std::array<T, LANES> n;
+    std::array<bool, LANES> passed;
+    std::size_t i = 0;
+    for (; candidates.size() - i >= LANES; i += LANES) {
+        for (std::size_t j = 0; j < LANES; ++j)
+            n[j] = candidates[i + j];
+        hc::detail::impl_batch_prp_filter::call<MF>(n, passed);
+        for (std::size_t j = 0; j < LANES; ++j)
+            survivors += passed[j];
+    }
+    std::array<T, 1> n1;
+    std::array<bool, 1> passed1;
+    for (; i < candidates.size(); ++i) {
+        n1[0] = candidates[i];
+        hc::detail::impl_batch_prp_filter::call<MF>(n1, passed1);
+        survivors += passed1[0];
+    }
+    return survivors;
+}
+
+
+template <typename T, std::size_t LANES>
+std::size_t filter_bucketed(const std::vector<T>& candidates)
+{
+    namespace hc = ::hurchalla;
+    // counts the survivors without storing them
+    struct CountingIterator {
+        std::size_t* count;
+        CountingIterator& operator*() { return *this; }
+        CountingIterator& operator=(T) { ++*count; return *this; }
+        CountingIterator& operator++() { return *this; }
+        CountingIterator operator++(int) { return *this; }
+    };
+    std::size_t survivors = 0;
+    hc::BatchPrpFilter<T, LANES> filter;
+    filter.filter(candidates.begin(), candidates.end(),
+                  CountingIterator{ &survivors });
+    return survivors;
+}
+
+
+template <typename T>
+bool bench(const std::string& name, int min_bits, std::mt19937_64& gen)
+{
+    using namespace std::chrono;
+    std::vector<T> candidates(NUM_CANDIDATES);
+    for (auto& c : candidates)
+        c = random_candidate<T>(gen, min_bits);
+
+    std::cout << name << ", bit lengths " << min_bits << " to "
+              << hurchalla::ut_numeric_limits<T>::digits << "\n";
+    double count = static_cast<double>(NUM_CANDIDATES);
+    std::size_t expected = 0;
+    bool ok = true;
+
+    auto report = [&](const char* method, std::size_t survivors,
+                      steady_clock::time_point t0, steady_clock::time_point t1)
+    {
+        std::cout << "  " << method << ": "
+                  << (count / duration<double>(t1 - t0).count()) / 1e6
+                  << " million candidates/sec  (" << survivors
+                  << " survivors)\n";
+        if (expected == 0)
+            expected = survivors;
+        else if (survivors != expected) {
+            std::cout << "  bug: the survivor counts differ\n";
+            ok = false;
+        }
+    };
+
+    auto t0 = steady_clock::now();
+    std::size_t s = filter_unbucketed<T, 1>(candidates);
+    auto t1 = steady_clock::now();
+    report("one at a time      ", s, t0, t1);
+
+    t0 = steady_clock::now();
+    s = filter_unbucketed<T, 4>(candidates);
+    t1 = steady_clock::now();
+    report("unbucketed LANES=4 ", s, t0, t1);
+
+    t0 = steady_clock::now();
+    s = filter_bucketed<T, 2>(candidates);
+    t1 = steady_clock::now();
+    report("BatchPrpFilter  2  ", s, t0, t1);
+
+    t0 = steady_clock::now();
+    s = filter_bucketed<T, 3>(candidates);
+    t1 = steady_clock::now();
+    report("BatchPrpFilter  3  ", s, t0, t1);
+
+    t0 = steady_clock::now();
+    s = filter_bucketed<T, 4>(candidates);
+    t1 = steady_clock::now();
+    report("BatchPrpFilter  4  ", s, t0, t1);
+
+    t0 = steady_clock::now();
+    s = filter_bucketed<T, 6>(candidates);
+    t1 = steady_clock::now();
+    report("BatchPrpFilter  6  ", s, t0, t1);
+
+    t0 = steady_clock::now();
+    s = filter_bucketed<T, 8>(candidates);
+    t1 = steady_clock::now();
+    report("BatchPrpFilter  8  ", s, t0, t1);
+
+    return ok;
+}
+
+
+int main(int argc, char** argv)
+{
+    std::cout << "---Running Program---\n";
+
+    unsigned int randomization_seed = 1;
+    if (argc > 1)
+        randomization_seed = static_cast<unsigned int>(std::stoul(argv[1]));
+    std::mt19937_64 gen(randomization_seed);
+
+    std::cout << std::fixed;
+    std::cout.precision(3);
+
+    bool ok = true;
+    ok = ok && bench<std::uint32_t>("uint32_t", 16, gen);
+    ok = ok && bench<std::uint64_t>("uint64_t", 32, gen);
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    ok = ok && bench<__uint128_t>("__uint128_t", 64, gen);
+#endif
+    return ok ? 0 : 1;
+}
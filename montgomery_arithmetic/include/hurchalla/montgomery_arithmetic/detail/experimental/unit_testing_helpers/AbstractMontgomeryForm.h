@@ -201,6 +201,8 @@ public:
 
     virtual MontgomeryValue two_pow(IntegerType exponent) const = 0;
 
+    virtual int jacobi(MontgomeryValue x) const = 0;
+
 private:
     virtual MontgomeryValue convertIn(IntegerType a,
         bool useLowlatencyTag) const = 0;
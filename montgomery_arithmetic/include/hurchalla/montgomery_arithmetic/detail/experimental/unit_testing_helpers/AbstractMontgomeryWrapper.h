@@ -39,6 +39,21 @@ public:
     IntegerType convertOut(MontgomeryValue x) const
         { return pimpl->template convertOut<PTAG>(x); }
 
+    template <class PTAG = LowuopsTag>
+    void convertIn(MontgomeryValue* result, const IntegerType* a,
+                   std::size_t count) const
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            result[i] = pimpl->template convertIn<PTAG>(a[i]);
+    }
+    template <class PTAG = LowuopsTag>
+    void convertOut(IntegerType* result, const MontgomeryValue* x,
+                    std::size_t count) const
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            result[i] = pimpl->template convertOut<PTAG>(x[i]);
+    }
+
     CanonicalValue getCanonicalValue(MontgomeryValue x) const
         { return pimpl->getCanonicalValue(x); }
     FusingValue getFusingValue(MontgomeryValue x) const
@@ -131,6 +146,18 @@ public:
     template <class PTAG = LowlatencyTag>
     CanonicalValue inverse(MontgomeryValue x) const
         { return pimpl->template inverse<PTAG>(x); }
+    template <class PTAG = LowlatencyTag>
+    std::size_t inverse(CanonicalValue* result, const MontgomeryValue* x,
+                        std::size_t count) const
+    {
+        std::size_t num_noninvertible = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            result[i] = pimpl->template inverse<PTAG>(x[i]);
+            if (result[i] == pimpl->getZeroValue())
+                ++num_noninvertible;
+        }
+        return num_noninvertible;
+    }
 
     MontgomeryValue pow(MontgomeryValue base, IntegerType exponent) const
         { return pimpl->pow(base, exponent); }
@@ -138,6 +165,14 @@ public:
     MontgomeryValue two_pow(IntegerType exponent) const
         { return pimpl->two_pow(exponent); }
 
+    int jacobi(MontgomeryValue x) const
+        { return pimpl->jacobi(x); }
+    void jacobi(int* result, const MontgomeryValue* x, std::size_t count) const
+    {
+        for (std::size_t i = 0; i < count; ++i)
+            result[i] = pimpl->jacobi(x[i]);
+    }
+
     template <std::size_t NUM_BASES>
     std::array<MontgomeryValue, NUM_BASES>
     pow(const std::array<MontgomeryValue, NUM_BASES>& bases, IntegerType exponent) const
@@ -146,6 +181,17 @@ public:
     template <class F>
     IntegerType gcd_with_modulus(MontgomeryValue x, const F& gcd_functor) const
         { return pimpl->gcd_with_modulus(x, gcd_functor); }
+    template <class F>
+    IntegerType gcd_with_modulus(const MontgomeryValue* x, std::size_t count,
+                                 const F& gcd_functor, std::size_t& index) const
+    {
+        for (index = 0; index < count; ++index) {
+            IntegerType g = pimpl->gcd_with_modulus(x[index], gcd_functor);
+            if (g != 1)
+                return g;
+        }
+        return 1;
+    }
 
     template <class PTAG = LowlatencyTag>
     IntegerType remainder(IntegerType a) const
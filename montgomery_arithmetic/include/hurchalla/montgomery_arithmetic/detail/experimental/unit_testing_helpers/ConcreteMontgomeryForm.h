@@ -355,6 +355,11 @@ public:
         return OpenV(static_cast<typename OpenV::OT>(mfv.get()));
     }
 
+    virtual int jacobi(V x) const override
+    {
+        return mf.jacobi(OpenMFV(OpenV(x)));
+    }
+
     virtual V pow(V base, T exponent) const override
     {
         HPBC_CLOCKWORK_PRECONDITION2(0 <= exponent);
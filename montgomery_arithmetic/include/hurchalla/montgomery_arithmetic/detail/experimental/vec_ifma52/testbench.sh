@@ -0,0 +1,81 @@
+#!/bin/bash
+
+# Copyright (c) 2025 Jeffrey Hurchalla.
+#
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+
+
+
+# You need to clone the util and modular_arithmetic repos
+# from https://github.com/hurchalla
+
+# SET repo_directory TO THE DIRECTORY WHERE YOU CLONED THE HURCHALLA GIT
+# REPOSITORIES.  (or otherwise ensure the compiler /I flags correctly specify
+# the needed hurchalla include directories)
+
+repo_directory=/Users/jeffreyhurchalla/Desktop
+#repo_directory=/home/jeff/repos
+
+
+# you would ordinarily use either g++ or clang++  for $1
+cppcompiler=$1
+
+
+if [[ $cppcompiler == "g++" ]]; then
+  error_limit=-fmax-errors=3
+else
+  error_limit=-ferror-limit=3
+fi
+
+
+exit_on_failure () {
+  if [ $? -ne 0 ]; then
+    exit 1
+  fi
+}
+
+#optimization_level=O2
+#optimization_level=O3
+optimization_level=$2
+
+cpp_standard=c++17
+
+
+# To benchmark the AVX-512 IFMA code path, the compiler must target a CPU
+# with IFMA, e.g. pass -march=native as argument $4 (on a CPU that has IFMA),
+# or pass -mavx512f -mavx512ifma.  Without those flags the benchmark measures
+# MontyVecIFMA52's portable scalar fallback.
+# You can use arguments $4 and $5 and $6 etc to define macros or flags such as
+# -march=native
+# for debugging, defining the following macros may be useful
+# -DHURCHALLA_CLOCKWORK_ENABLE_ASSERTS  -DHURCHALLA_UTIL_ENABLE_ASSERTS
+
+
+$cppcompiler   \
+        $error_limit   -$optimization_level \
+         $4 $5 $6 $7 $8 \
+        -Wall -Wextra -Wpedantic -Wconversion -Wsign-conversion \
+        -std=$cpp_standard \
+        -I${repo_directory}/modular_arithmetic/modular_arithmetic/include \
+        -I${repo_directory}/modular_arithmetic/montgomery_arithmetic/include \
+        -I${repo_directory}/util/include \
+        -c testbench_vec_ifma52.cpp
+
+exit_on_failure
+
+$cppcompiler  -$optimization_level  -std=$cpp_standard  $4 $5 $6 $7 $8  -o testbench_vec_ifma52  testbench_vec_ifma52.o -lm
+
+exit_on_failure
+
+echo "compilation finished, now executing:"
+
+
+# argument $3 (if present), is the randomization seed for std::mt19937_64
+
+./testbench_vec_ifma52 $3
+
+# To give you an example of invoking this script at the command line:
+#   ./testbench.sh clang++ O3 1 -march=native
@@ -0,0 +1,151 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Benchmarks MontyVecIFMA52 (8 lanes of 50 bit moduli) against 8 interleaved
+// MontgomeryQuarter<uint64_t> objects given the same moduli.  Both perform
+// the same dependent chain of fused multiply-adds and squarings in each lane,
+// and we check that both produce identical results.
+
+#include "hurchalla/montgomery_arithmetic/detail/experimental/MontyVecIFMA52.h"
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/util/compiler_macros.h"
+
+#include <iostream>
+#include <chrono>
+#include <array>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+
+#if defined(HURCHALLA_CLOCKWORK_ENABLE_ASSERTS) || defined(HURCHALLA_UTIL_ENABLE_ASSERTS)
+#  warning "asserts are enabled and will slow performance"
+#endif
+
+
+using U = std::uint64_t;
+using MV = hurchalla::detail::MontyVecIFMA52;
+using MF = hurchalla::MontgomeryQuarter<U>;
+using LaneArray = MV::lane_array;
+
+constexpr int CHAIN_LENGTH = 2000;
+
+
+LaneArray run_vec(const LaneArray& moduli, const LaneArray& a,
+                  const LaneArray& c)
+{
+    MV mv(moduli);
+    MV::V x = mv.convertIn(a);
+    MV::C z = mv.getCanonicalValue(mv.convertIn(c));
+    MV::V acc = x;
+    for (int k=0; k<CHAIN_LENGTH; ++k) {
+        acc = mv.fmadd(acc, x, z);
+        acc = mv.square(acc);
+    }
+    return mv.convertOut(acc);
+}
+
+LaneArray run_scalar(const LaneArray& moduli, const LaneArray& a,
+                     const LaneArray& c)
+{
+    constexpr std::size_t L = MV::LANES;
+    // MontgomeryForm has no default constructor, so we use a vector.
+    std::vector<MF> mf;
+    mf.reserve(L);
+    for (std::size_t i=0; i<L; ++i)
+        mf.emplace_back(moduli[i]);
+    std::array<MF::MontgomeryValue, L> x, acc;
+    std::array<MF::CanonicalValue, L> z;
+    for (std::size_t i=0; i<L; ++i) {
+        x[i] = mf[i].convertIn(a[i]);
+        z[i] = mf[i].getCanonicalValue(mf[i].convertIn(c[i]));
+        acc[i] = x[i];
+    }
+    for (int k=0; k<CHAIN_LENGTH; ++k) {
+        HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<L; ++i) {
+            acc[i] = mf[i].fmadd(acc[i], x[i], z[i]);
+            acc[i] = mf[i].square(acc[i]);
+        }
+    }
+    LaneArray result;
+    for (std::size_t i=0; i<L; ++i)
+        result[i] = mf[i].convertOut(acc[i]);
+    return result;
+}
+
+
+int main(int argc, char** argv)
+{
+    std::cout << "---Running Program---\n";
+
+    unsigned int randomization_seed = 1;
+    if (argc > 1)
+        randomization_seed = static_cast<unsigned int>(std::stoul(argv[1]));
+
+#ifdef HURCHALLA_MONTY_VEC_IFMA52_USES_AVX512
+    std::cout << "MontyVecIFMA52 is using the AVX-512 IFMA code path\n";
+#else
+    std::cout << "MontyVecIFMA52 is using the portable scalar code path\n";
+#endif
+
+    constexpr std::size_t NUM_MODULI_SETS = 2000;
+    std::mt19937_64 gen(randomization_seed);
+    std::uniform_int_distribution<U> dist(MV::max_modulus()/4,
+                                          MV::max_modulus()/2);
+    std::vector<LaneArray> moduli(NUM_MODULI_SETS), a(NUM_MODULI_SETS),
+                           c(NUM_MODULI_SETS);
+    for (std::size_t j=0; j<NUM_MODULI_SETS; ++j) {
+        for (std::size_t i=0; i<MV::LANES; ++i) {
+            U n = 2*dist(gen) + 1;
+            moduli[j][i] = n;
+            a[j][i] = gen() % n;
+            c[j][i] = gen() % n;
+        }
+    }
+
+    using namespace std::chrono;
+    U dummy = 0;  // prevents the compiler from optimizing away the work
+
+    std::cout << std::fixed;
+    std::cout.precision(4);
+
+    for (int rep=0; rep<3; ++rep) {
+        auto t0 = steady_clock::now();
+        for (std::size_t j=0; j<NUM_MODULI_SETS; ++j) {
+            LaneArray r = run_vec(moduli[j], a[j], c[j]);
+            dummy += r[0] + r[MV::LANES - 1];
+        }
+        auto t1 = steady_clock::now();
+        for (std::size_t j=0; j<NUM_MODULI_SETS; ++j) {
+            LaneArray r = run_scalar(moduli[j], a[j], c[j]);
+            dummy += r[0] + r[MV::LANES - 1];
+        }
+        auto t2 = steady_clock::now();
+
+        double ops = 2.0 * CHAIN_LENGTH * NUM_MODULI_SETS * MV::LANES;
+        double vtime = duration<double>(t1 - t0).count();
+        double stime = duration<double>(t2 - t1).count();
+        std::cout << "MontyVecIFMA52:               " << vtime << " sec, "
+                  << (ops / vtime) / 1e6 << " million modmults/sec\n";
+        std::cout << "8x MontgomeryQuarter<uint64_t>: " << stime << " sec, "
+                  << (ops / stime) / 1e6 << " million modmults/sec\n";
+    }
+
+    for (std::size_t j=0; j<NUM_MODULI_SETS; ++j) {
+        if (run_vec(moduli[j], a[j], c[j]) != run_scalar(moduli[j], a[j], c[j])) {
+            std::cout << "bug in MontyVecIFMA52 found: results differ from "
+                      << "MontgomeryQuarter\n";
+            return 1;
+        }
+    }
+
+    std::cout << "ignore: " << dummy << "\n";
+    return 0;
+}
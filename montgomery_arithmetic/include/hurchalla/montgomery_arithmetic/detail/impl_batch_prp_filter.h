@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_BATCH_PRP_FILTER_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_BATCH_PRP_FILTER_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/platform_specific/montgomery_two_pow.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/count_trailing_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: for each lane i, with n[i]-1 == d*2^s for odd d, n[i]
+// is a base 2 strong probable prime if 2^d == 1 (mod n[i]), or if
+// 2^(d*2^r) == -1 (mod n[i]) for some 0 <= r < s.  We compute 2^d for every
+// lane with the array version of montgomery two_pow, using a separate
+// MontgomeryForm for each lane.  That function's loop runs for as many bits as
+// the largest exponent, which is why the caller should give us moduli of
+// (nearly) the same bit length.  The squarings that follow are independent
+// between the lanes, so we interleave them too.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_batch_prp_filter {
+ private:
+  template <std::size_t... I> struct IndexSeq {};
+  template <std::size_t N, std::size_t... I>
+  struct MakeIndexSeq : MakeIndexSeq<N-1, N-1, I...> {};
+  template <std::size_t... I>
+  struct MakeIndexSeq<0, I...> { using type = IndexSeq<I...>; };
+
+  // MontgomeryForm has const members and no default constructor, so we
+  // construct the array of forms directly from the array of moduli.
+  template <class MF, std::size_t LANES, std::size_t... I>
+  static std::array<MF, LANES>
+  make_forms(const std::array<typename MF::IntegerType, LANES>& n,
+             IndexSeq<I...>)
+  {
+    return {{ MF(n[I])... }};
+  }
+
+ public:
+  // MF must be a MontgomeryForm type that can be constructed from every n[i].
+  // Sets passed[i] to true if n[i] is a base 2 strong probable prime, and
+  // otherwise to false.  Requires every n[i] to be odd and greater than 2.
+  template <class MF, std::size_t LANES>
+  static void call(const std::array<typename MF::IntegerType, LANES>& n,
+                   std::array<bool, LANES>& passed)
+  {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+    using C = typename MF::CanonicalValue;
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+
+    const std::array<MF, LANES> mf = make_forms<MF, LANES>(n,
+                                    typename MakeIndexSeq<LANES>::type());
+    std::array<T, LANES> d;
+    std::array<int, LANES> s;
+    int s_max = 0;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<LANES; ++i) {
+        HPBC_CLOCKWORK_PRECONDITION2(n[i] > 2 && n[i] % 2 == 1);
+        d[i] = static_cast<T>(n[i] - 1);
+        s[i] = count_trailing_zeros(d[i]);
+        d[i] = static_cast<T>(d[i] >> s[i]);
+        s_max = (s_max < s[i]) ? s[i] : s_max;
+    }
+
+    std::array<V, LANES> x = montgomery_two_pow::call(mf, d);
+
+    std::array<C, LANES> minus_one;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<LANES; ++i) {
+        minus_one[i] = mf[i].getNegativeOneValue();
+        C c = mf[i].getCanonicalValue(x[i]);
+        passed[i] = (c == mf[i].getUnityValue() || c == minus_one[i]);
+    }
+    for (int r=1; r<s_max; ++r) {
+        HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<LANES; ++i) {
+            if (!passed[i] && r < s[i]) {
+                x[i] = mf[i].square(x[i]);
+                passed[i] = (mf[i].getCanonicalValue(x[i]) == minus_one[i]);
+            }
+        }
+    }
+  }
+};
+
+
+}} // end namespace
+
+#endif
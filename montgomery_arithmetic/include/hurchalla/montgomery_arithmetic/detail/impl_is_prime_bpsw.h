@@ -0,0 +1,181 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_IS_PRIME_BPSW_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_IS_PRIME_BPSW_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/impl_is_prime_miller_rabin.h"
+#include "hurchalla/montgomery_arithmetic/detail/impl_is_prime_dispatch.h"
+#include "hurchalla/modular_arithmetic/jacobi.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/count_leading_zeros.h"
+#include "hurchalla/util/count_trailing_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstdint>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: the Baillie-PSW test is a base 2 strong probable prime
+// test followed by a strong Lucas probable prime test (see Baillie and
+// Wagstaff, "Lucas Pseudoprimes", Math. Comp. 1980).  No composite is known to
+// pass both tests, and it has been verified that none below 2^64 exists.
+//
+// For the Lucas test we use Selfridge's method A for the parameters: D is the
+// first element of 5, -7, 9, -11, 13, ... for which the Jacobi symbol (D/n) is
+// -1, with P = 1 and Q = (1 - D)/4.  If n is a perfect square, no such D
+// exists, so we check for a square if the first few values of D fail.  With
+// n + 1 == d*2^s for odd d, n is a strong Lucas probable prime if U_d == 0
+// (mod n), or if V_(d*2^r) == 0 (mod n) for some 0 <= r < s.
+//
+// We compute U_d and V_d with the binary method, scanning the bits of d from
+// the most significant, and using the identities
+//   U_2k = U_k * V_k          V_2k = V_k^2 - 2*Q^k
+//   U_(k+1) = (P*U_k + V_k)/2     V_(k+1) = (D*U_k + P*V_k)/2
+// Since n is odd, the division by 2 is MontgomeryForm's halve(), and so the
+// entire computation stays in the Montgomery domain.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_is_prime_bpsw {
+
+  // Returns true if x is prime, or if x is a composite that passes both the
+  // base 2 strong probable prime test and the strong Lucas test.
+  template <typename U>
+  static bool call(U x)
+  {
+    return impl_is_prime_dispatch::call(x, bpsw_test<true>());
+  }
+
+  // Returns true if x is prime, or if x is a strong Lucas pseudoprime.
+  template <typename U>
+  static bool call_lucas(U x)
+  {
+    return impl_is_prime_dispatch::call(x, bpsw_test<false>());
+  }
+
+private:
+  template <bool BASE2>
+  struct bpsw_test {
+    template <class MF>
+    bool operator()(const MF& mf) const
+    {
+      return test_with<BASE2>(mf);
+    }
+  };
+
+  template <bool BASE2, class MF>
+  static bool test_with(const MF& mf)
+  {
+    using T = typename MF::IntegerType;
+    if (BASE2 && !impl_is_prime_miller_rabin::strong_probable_prime(mf,
+                                                    std::array<T,1>{{ 2 }}))
+        return false;
+    return strong_lucas(mf);
+  }
+
+  // Returns true if the modulus n of mf is a strong Lucas probable prime with
+  // Selfridge's parameters.  Requires n > 63 and n odd.
+  template <class MF>
+  static bool strong_lucas(const MF& mf)
+  {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+    using C = typename MF::CanonicalValue;
+    const T n = mf.getModulus();
+    HPBC_CLOCKWORK_PRECONDITION2(n > 63 && n % 2 == 1);
+
+    // Find D = (-1)^i * (5 + 2*i), with (D/n) == -1.
+    T absD = 5;
+    bool negativeD = false;
+    for (int i = 0; ; ++i) {
+        T a = static_cast<T>(absD % n);
+        if (negativeD && a != 0)
+            a = static_cast<T>(n - a);
+        int j = ::hurchalla::jacobi(a, n);
+        if (j == -1)
+            break;
+        if (j == 0 && absD != n)
+            return false;   // gcd(absD, n) is a nontrivial factor of n
+        if (i == 4 && is_perfect_square(n))
+            return false;
+        absD = static_cast<T>(absD + 2);
+        negativeD = !negativeD;
+    }
+    // Q = (1 - D)/4, which is negative when D is positive.
+    T absQ = negativeD ? static_cast<T>((absD + 1)/4)
+                       : static_cast<T>((absD - 1)/4);
+    V D = mf.convertIn(absD);
+    V Q = mf.convertIn(absQ);
+    if (!negativeD) {
+        Q = mf.negate(Q);
+    } else {
+        D = mf.negate(D);
+    }
+
+    // The maximum value of T (2^digits - 1) is divisible by 3, and we need
+    // to exclude it since n + 1 would overflow.
+    if (n == ut_numeric_limits<T>::max())
+        return false;
+    T d = static_cast<T>(n + 1);
+    int s = count_trailing_zeros(d);
+    d = static_cast<T>(d >> s);
+
+    // Start with k = 1:  U_1 = 1, V_1 = P = 1, and Q^1 = Q.
+    V U = mf.getUnityValue();
+    V Vk = mf.getUnityValue();
+    V Qk = Q;
+    constexpr int digits = ut_numeric_limits<T>::digits;
+    int shift = digits - 1 - count_leading_zeros(d);
+    for (int b = shift - 1; b >= 0; --b) {
+        U = mf.multiply(U, Vk);
+        Vk = mf.subtract(mf.square(Vk), mf.two_times(Qk));
+        Qk = mf.square(Qk);
+        if ((d >> b) & 1u) {
+            V tmp = mf.halve(mf.add(U, Vk));
+            Vk = mf.halve(mf.add(mf.multiply(D, U), Vk));
+            U = tmp;
+            Qk = mf.multiply(Qk, Q);
+        }
+    }
+
+    const C zero = mf.getZeroValue();
+    if (mf.getCanonicalValue(U) == zero || mf.getCanonicalValue(Vk) == zero)
+        return true;
+    for (int r = 1; r < s; ++r) {
+        Vk = mf.subtract(mf.square(Vk), mf.two_times(Qk));
+        if (mf.getCanonicalValue(Vk) == zero)
+            return true;
+        Qk = mf.square(Qk);
+    }
+    return false;
+  }
+
+  template <typename T>
+  static bool is_perfect_square(T n)
+  {
+    // Newton's method for the integer square root, starting from a value
+    // that is at least as large as the root.
+    constexpr int digits = ut_numeric_limits<T>::digits;
+    int bits = digits - count_leading_zeros(n);
+    T x = static_cast<T>(static_cast<T>(1) << ((bits + 1) / 2));
+    T y = static_cast<T>((x + n / x) / 2);
+    while (y < x) {
+        x = y;
+        y = static_cast<T>((x + n / x) / 2);
+    }
+    return x * x == n;
+  }
+};
+
+
+}} // end namespace
+
+#endif
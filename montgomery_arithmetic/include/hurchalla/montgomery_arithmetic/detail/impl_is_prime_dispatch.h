@@ -0,0 +1,98 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_IS_PRIME_DISPATCH_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_IS_PRIME_DISPATCH_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <type_traits>
+#include <cstdint>
+
+namespace hurchalla { namespace detail {
+
+
+// The common front end of the primality tests (impl_is_prime_miller_rabin and
+// impl_is_prime_bpsw).  call(x, test) answers directly for x < 64 and for even
+// x.  Otherwise it narrows x to the smallest of uint32_t, uint64_t, or U that
+// can hold its value, constructs the fastest MontgomeryForm for it (the
+// MontgomeryQuarter, MontgomeryHalf, or MontgomeryFull type), and returns
+// test(mf).  TEST must be a function object with a member function template
+//   template <class MF> bool operator()(const MF& mf) const;
+// and it can rely on the modulus of mf being odd and greater than 63, and on
+// the modulus being too large to fit in a smaller type in the list above.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_is_prime_dispatch {
+
+  template <typename U, class TEST>
+  static bool call(U x, const TEST& test)
+  {
+    static_assert(ut_numeric_limits<U>::is_integer, "");
+    static_assert(!(ut_numeric_limits<U>::is_signed), "");
+    static_assert(ut_numeric_limits<U>::digits <= 128, "");
+    // bit i of this constant is set if i is a prime number.
+    constexpr std::uint64_t primes_below_64 = UINT64_C(0x28208a20a08a28ac);
+    if (x < 64)
+        return ((primes_below_64 >> static_cast<int>(x)) & 1u) != 0;
+    if (x % 2 == 0)
+        return false;
+    using W = typename std::conditional<
+                  (ut_numeric_limits<U>::digits <= 32), std::uint32_t,
+                  typename std::conditional<
+                      (ut_numeric_limits<U>::digits <= 64), std::uint64_t,
+                      U>::type
+                  >::type;
+    return call_odd(static_cast<W>(x), test);
+  }
+
+private:
+  // Each call_odd() requires an odd n > 63.
+  template <class TEST>
+  static bool call_odd(std::uint32_t n, const TEST& test)
+  {
+    return test_odd(n, test);
+  }
+  template <class TEST>
+  static bool call_odd(std::uint64_t n, const TEST& test)
+  {
+    if ((n >> 32) == 0)
+        return call_odd(static_cast<std::uint32_t>(n), test);
+    return test_odd(n, test);
+  }
+#if (HURCHALLA_COMPILER_HAS_UINT128_T())
+  template <class TEST>
+  static bool call_odd(__uint128_t n, const TEST& test)
+  {
+    if ((n >> 64) == 0)
+        return call_odd(static_cast<std::uint64_t>(n), test);
+    return test_odd(n, test);
+  }
+#endif
+
+  template <typename T, class TEST>
+  static bool test_odd(T n, const TEST& test)
+  {
+    HPBC_CLOCKWORK_PRECONDITION2(n > 63 && n % 2 == 1);
+    constexpr int digits = ut_numeric_limits<T>::digits;
+    if ((n >> (digits - 2)) == 0)
+        return test(MontgomeryQuarter<T>(n));
+    else if ((n >> (digits - 1)) == 0)
+        return test(MontgomeryHalf<T>(n));
+    else
+        return test(MontgomeryFull<T>(n));
+  }
+};
+
+
+}} // end namespace
+
+#endif
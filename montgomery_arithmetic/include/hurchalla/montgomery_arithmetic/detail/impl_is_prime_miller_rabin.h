@@ -0,0 +1,161 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_IS_PRIME_MILLER_RABIN_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_IS_PRIME_MILLER_RABIN_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/impl_is_prime_dispatch.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/count_trailing_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstdint>
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: n is prime only if it is a strong probable prime to
+// every base a, i.e. with n-1 == d*2^s for odd d, either a^d == 1 (mod n) or
+// a^(d*2^r) == -1 (mod n) for some 0 <= r < s.  For each integer width we use
+// the smallest known set of bases for which no composite n of that width
+// passes every base:
+//   n < 2^32:  the bases 2, 7, 61  (Jaeschke, 1993)
+//   n < 2^64:  the bases 2, 325, 9375, 28178, 450775, 9780504, 1795265022
+//              (Sinclair, 2011)
+//   n < 3317044064679887385961981 (about 2^81.5):  the 13 primes 2 through 41
+//              (Sorenson and Webster, 2015)
+// No such set of bases is known for larger n.  For n above that bound we use
+// the same 13 prime bases, which gives us a strong probable prime test; no
+// composite is known to pass it, but that has not been proven.
+//
+// We compute the first power for a group of bases with the array version of
+// MontgomeryForm::pow(), which overlaps the independent multiplies of the
+// different bases.  The pow() documentation recommends 3 to 6 bases per call,
+// so we split larger sets of bases into groups, and since most composites fail
+// the very first group, we don't test any later groups once a group fails.
+// impl_is_prime_dispatch gives us a MontgomeryQuarter or MontgomeryHalf when n
+// is small enough for them, since they are faster than MontgomeryFull.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_is_prime_miller_rabin {
+
+  template <typename U>
+  static bool call(U x)
+  {
+    return impl_is_prime_dispatch::call(x, test_bases());
+  }
+
+  // Returns true if the modulus n of mf is a strong probable prime to every
+  // base.  Requires n to be odd, and every base to satisfy 0 < base < n.
+  template <class MF, std::size_t N>
+  static bool
+  strong_probable_prime(const MF& mf,
+                        const std::array<typename MF::IntegerType, N>& bases)
+  {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+    using C = typename MF::CanonicalValue;
+    T n = mf.getModulus();
+    HPBC_CLOCKWORK_PRECONDITION2(n > 2 && n % 2 == 1);
+
+    T d = static_cast<T>(n - 1);
+    int s = count_trailing_zeros(d);
+    d = static_cast<T>(d >> s);
+
+    std::array<V, N> x;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+        HPBC_CLOCKWORK_ASSERT2(0 < bases[i] && bases[i] < n);
+        x[i] = mf.convertIn(bases[i]);
+    }
+    x = mf.pow(x, d);
+
+    const C one = mf.getUnityValue();
+    const C minus_one = mf.getNegativeOneValue();
+    std::array<bool, N> passed;
+    bool all_passed = true;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+        C c = mf.getCanonicalValue(x[i]);
+        passed[i] = (c == one || c == minus_one);
+        all_passed = all_passed && passed[i];
+    }
+    // Once a square is 1 without having been -1, it remains 1 and so it will
+    // never pass.  We don't bother to detect this, since it costs a branch and
+    // it can only happen for a composite n.
+    for (int r=1; r<s && !all_passed; ++r) {
+        all_passed = true;
+        HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<N; ++i) {
+            if (!passed[i]) {
+                x[i] = mf.square(x[i]);
+                passed[i] = (mf.getCanonicalValue(x[i]) == minus_one);
+                all_passed = all_passed && passed[i];
+            }
+        }
+    }
+    return all_passed;
+  }
+
+private:
+  struct test_bases {
+    template <class MF>
+    bool operator()(const MF& mf) const
+    {
+      return test_width(mf, typename MF::IntegerType());
+    }
+  };
+
+  // Each test_width() overload tests the odd modulus n of mf with the bases
+  // for n's width.  impl_is_prime_dispatch guarantees n > 63, and that n is
+  // too large for a smaller type, so every base is less than n.
+  template <class MF>
+  static bool test_width(const MF& mf, std::uint32_t)
+  {
+    using T = std::uint32_t;
+    return test_groups_with(mf, std::array<T,3>{{ 2, 7, 61 }});
+  }
+  template <class MF>
+  static bool test_width(const MF& mf, std::uint64_t)
+  {
+    using T = std::uint64_t;
+    return test_groups_with(mf,
+              std::array<T,3>{{ 2, 325, 9375 }},
+              std::array<T,4>{{ 28178, 450775, 9780504, 1795265022 }});
+  }
+#if (HURCHALLA_COMPILER_HAS_UINT128_T())
+  template <class MF>
+  static bool test_width(const MF& mf, __uint128_t)
+  {
+    using T = __uint128_t;
+    return test_groups_with(mf,
+              std::array<T,4>{{ 2, 3, 5, 7 }},
+              std::array<T,3>{{ 11, 13, 17 }},
+              std::array<T,3>{{ 19, 23, 29 }},
+              std::array<T,3>{{ 31, 37, 41 }});
+  }
+#endif
+
+  template <class MF>
+  static bool test_groups_with(const MF&)
+  {
+    return true;
+  }
+  template <class MF, std::size_t N, std::size_t... Ns>
+  static bool test_groups_with(const MF& mf,
+                 const std::array<typename MF::IntegerType, N>& group,
+                 const std::array<typename MF::IntegerType, Ns>&... groups)
+  {
+    return strong_probable_prime(mf, group) && test_groups_with(mf, groups...);
+  }
+};
+
+
+}} // end namespace
+
+#endif
@@ -0,0 +1,107 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MAKE_MONTGOMERY_FORMS_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MAKE_MONTGOMERY_FORMS_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/MontgomeryFormExtensions.h"
+#include "hurchalla/montgomery_arithmetic/detail/MontyCommonBase.h"
+#include "hurchalla/montgomery_arithmetic/detail/MontyTags.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/get_R_mod_n.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/inverse_mod_R.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/get_Rsquared_mod_n.h"
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <type_traits>
+#include <array>
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Minor note: uses static member functions to disallow ADL.
+template <class MF>
+struct impl_make_montgomery_forms {
+ private:
+  using T = typename MF::IntegerType;
+  using MontyType = typename MF::MontType;
+  using U = typename MontyType::uint_type;
+
+  // The number of moduli whose constants we compute together.  The std::array
+  // version of get_Rsquared_mod_n interleaves its work across this many
+  // moduli, and inverse_mod_R(result, a, count) vectorizes across them.
+  static constexpr std::size_t CHUNK = 16;
+
+  // For types wider than the CPU's native bit width (e.g. __uint128_t on a
+  // 64 bit CPU), the setup is limited by multiply throughput rather than by
+  // latency, and in perf testing the batched computation was slower than
+  // constructing the forms one at a time.  So we only batch native types.
+  static constexpr bool use_batched_setup =
+         std::is_constructible<MontyType,
+                               const MontyPrecomputedConstants<U>&>::value &&
+         (ut_numeric_limits<U>::digits <= HURCHALLA_TARGET_BIT_WIDTH);
+
+ public:
+  // Used for the montgomery types that derive from MontyCommonBase: we compute
+  // the constants R mod n, n^(-1) mod R, and R^2 mod n for a chunk of moduli
+  // at a time, and construct each form from its precomputed constants.
+  template <class OutputIt>
+  static typename std::enable_if<use_batched_setup, OutputIt>::type
+  call(const T* moduli, std::size_t count, OutputIt out)
+  {
+    constexpr bool isQuarterrange =
+                   std::is_same<typename MontyType::MontyTag,
+                                TagMontyQuarterrange>::value;
+    using MFE = MontgomeryFormExtensions<MF, LowuopsTag>;
+
+    std::array<U, CHUNK> n, r_mod_n, inv_n;
+    for (std::size_t start = 0; start < count; start += CHUNK) {
+        std::size_t len = (count - start < CHUNK) ? count - start : CHUNK;
+        for (std::size_t j = 0; j < len; ++j)
+            n[j] = static_cast<U>(moduli[start + j]);
+        // pad a partial chunk with a valid modulus; its results are unused
+        for (std::size_t j = len; j < CHUNK; ++j)
+            n[j] = 3;
+
+        for (std::size_t j = 0; j < CHUNK; ++j)
+            r_mod_n[j] = ::hurchalla::get_R_mod_n(n[j]);
+        ::hurchalla::inverse_mod_R(inv_n.data(), n.data(), CHUNK);
+        std::array<U, CHUNK> r_squared_mod_n = ::hurchalla::
+            get_Rsquared_mod_n<U, CHUNK, isQuarterrange, LowuopsTag>
+                                                         (n, inv_n, r_mod_n);
+
+        for (std::size_t j = 0; j < len; ++j) {
+            MontyPrecomputedConstants<U> pc =
+                            { n[j], r_mod_n[j], inv_n[j], r_squared_mod_n[j] };
+            *out = MFE::constructFromPrecomputed(pc);
+            ++out;
+        }
+    }
+    return out;
+  }
+
+  // Used for the montgomery types (e.g. MontyWrappedStandardMath) that have no
+  // montgomery constants to precompute, and for types wider than native.
+  template <class OutputIt>
+  static typename std::enable_if<!use_batched_setup, OutputIt>::type
+  call(const T* moduli, std::size_t count, OutputIt out)
+  {
+    for (std::size_t i = 0; i < count; ++i) {
+        *out = MF(moduli[i]);
+        ++out;
+    }
+    return out;
+  }
+};
+
+
+}} // end namespace
+
+#endif
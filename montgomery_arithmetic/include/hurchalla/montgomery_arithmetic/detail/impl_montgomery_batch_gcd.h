@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MONTGOMERY_BATCH_GCD_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MONTGOMERY_BATCH_GCD_H_INCLUDED
+
+
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: for values x[i] and the modulus n, gcd(x[0]*x[1]*...,n)
+// is 1 if and only if gcd(x[i],n) is 1 for every i.  So rather than calling
+// the gcd functor once per value, we multiply together a block of values and
+// call the gcd functor once for the entire block.  Only when that gcd is not 1
+// do we backtrack, calling the gcd functor for each value in the block, to find
+// the first value that shares a factor with the modulus.  Since a gcd costs far
+// more than a multiply, this is much faster whenever nontrivial gcds are rare
+// (as is typical for factoring algorithms like Pollard-Rho or P-1).
+//
+// If the product becomes zero, every later product in the block would also be
+// zero, so at that point we stop multiplying and backtrack immediately; the
+// multiply overload with a resultIsZero argument gives us this check cheaply.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_montgomery_batch_gcd {
+
+  // The number of values that we multiply together before calling the gcd
+  // functor.  A larger block amortizes the gcd over more values, but costs
+  // more gcds when we need to backtrack.
+  static constexpr std::size_t BLOCK_SIZE = 64;
+
+  // MF must be a MontgomeryForm type.  Returns the gcd of the modulus with the
+  // first value x[index] for which that gcd is not 1, and sets index.  If every
+  // value has a gcd of 1, returns 1 and sets index to count.
+  template <class MF, class F>
+  static typename MF::IntegerType
+  call(const MF& mf, const typename MF::MontgomeryValue* x, std::size_t count,
+       const F& gcd_functor, std::size_t& index)
+  {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+
+    for (std::size_t start = 0; start < count; start += BLOCK_SIZE) {
+        std::size_t end = (count - start > BLOCK_SIZE) ?
+                                                 start + BLOCK_SIZE : count;
+        // The products form a dependency chain, so we use LowlatencyTag.
+        V prod = x[start];
+        bool isZero = (mf.getCanonicalValue(prod) == mf.getZeroValue());
+        std::size_t i = start + 1;
+        for (; i < end && !isZero; ++i)
+            prod = mf.template multiply<LowlatencyTag>(prod, x[i], isZero);
+
+        if (!isZero && mf.gcd_with_modulus(prod, gcd_functor) == 1)
+            continue;
+
+        // backtrack over the values that went into prod
+        for (std::size_t j = start; j < i; ++j) {
+            T g = mf.gcd_with_modulus(x[j], gcd_functor);
+            if (g != 1) {
+                index = j;
+                return g;
+            }
+        }
+        // Since the gcd of prod was not 1, some x[j] must have a gcd that is
+        // not 1, and so we should have returned in the loop above.
+        HPBC_CLOCKWORK_ASSERT2(false);
+    }
+    index = count;
+    return 1;
+  }
+};
+
+
+}} // end namespace
+
+#endif
@@ -0,0 +1,92 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MONTGOMERY_BATCH_INVERSE_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MONTGOMERY_BATCH_INVERSE_H_INCLUDED
+
+
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: this uses Montgomery's trick for simultaneous
+// inversion.  We compute the prefix products p[i] = x[0]*x[1]*...*x[i-1], find
+// the inverse of the full product with a single call of inverse(), and then
+// walk backward: result[i] = inv * p[i], after which we update inv = inv * x[i]
+// so that it becomes the inverse of p[i].  This costs one inverse and about
+// 3*count multiplies, instead of count inverses.
+//
+// An element that is zero has no inverse; we leave it out of the products and
+// set its result to zero, so that it does not prevent the other elements from
+// being inverted.  If the modulus is composite, a nonzero element might still
+// have no inverse (when it shares a factor with the modulus), and then so does
+// the full product.  This is unusual, and for that case we simply invert every
+// element separately.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_montgomery_batch_inverse {
+
+  // MF must be a MontgomeryForm type.  Returns the number of elements of x that
+  // have no inverse; the results for those elements are set to zero.
+  template <class PTAG, class MF>
+  static std::size_t call(const MF& mf,
+                          typename MF::CanonicalValue* HURCHALLA_RESTRICT result,
+                          const typename MF::MontgomeryValue* HURCHALLA_RESTRICT x,
+                          std::size_t count)
+  {
+    using V = typename MF::MontgomeryValue;
+    using C = typename MF::CanonicalValue;
+    const C zero = mf.getZeroValue();
+
+    // The prefix products form a chain of dependent multiplies, and so do the
+    // updates of inv below, and so we use PTAG (which defaults to
+    // LowlatencyTag) for those multiplies.  We store the prefix products in
+    // 'result', as canonical values.
+    V prod = mf.getUnityValue();
+    for (std::size_t i = 0; i < count; ++i) {
+        result[i] = mf.getCanonicalValue(prod);
+        if (!(mf.getCanonicalValue(x[i]) == zero))
+            prod = mf.template multiply<PTAG>(prod, x[i]);
+    }
+
+    C inv_prod = mf.template inverse<PTAG>(prod);
+    if (inv_prod == zero) {
+        std::size_t num_noninvertible = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            result[i] = mf.template inverse<PTAG>(x[i]);
+            if (result[i] == zero)
+                ++num_noninvertible;
+        }
+        return num_noninvertible;
+    }
+
+    V inv = inv_prod;
+    std::size_t num_zeros = 0;
+    for (std::size_t i = count; i > 0; --i) {
+        std::size_t j = i - 1;
+        if (mf.getCanonicalValue(x[j]) == zero) {
+            result[j] = zero;
+            ++num_zeros;
+        } else {
+            result[j] = mf.getCanonicalValue(
+                        mf.template multiply<LowuopsTag>(inv, result[j]));
+            inv = mf.template multiply<PTAG>(inv, x[j]);
+        }
+    }
+    return num_zeros;
+  }
+};
+
+
+}} // end namespace
+
+#endif
@@ -0,0 +1,118 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MONTGOMERY_MULTI_POW_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_MONTGOMERY_MULTI_POW_H_INCLUDED
+
+
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/traits/extensible_make_unsigned.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/count_leading_zeros.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: this computes the product of several powers,
+//   bases[0]^exponents[0] * bases[1]^exponents[1] * ... (mod modulus),
+// using Straus' method with interleaved fixed windows.  Each base gets its own
+// small table of powers (base^0 through base^(2^TABLE_BITS - 1)), and all the
+// bases share a single chain of squarings, scanning TABLE_BITS bits of every
+// exponent per window.  Compared to computing each power separately and then
+// multiplying, this performs the squarings only once, instead of once per base.
+//
+// Within each window, the product of the selected table entries does not
+// depend on the running result, so it can be computed by the CPU in parallel
+// with the window's squarings; only a single multiply per window is added to
+// the result's dependency chain.
+//
+// We use a struct with static member functions to disallow ADL.
+
+struct impl_montgomery_multi_pow {
+
+  // MF must be a MontgomeryForm type (i.e. either plain MontgomeryForm, or one
+  // of its aliases like MontgomeryQuarter or MontgomeryHalf).
+  // For an exponent of k bits, this costs roughly k squarings, plus
+  // NUM_BASES * (k/TABLE_BITS + 2^TABLE_BITS) multiplies.  A TABLE_BITS of 3
+  // minimizes this for 32 and 64 bit exponents, and 4 does for 128 bits.
+  template <class MF, std::size_t NUM_BASES, int TABLE_BITS =
+          (ut_numeric_limits<typename MF::IntegerType>::digits > 64) ? 4 : 3>
+  static typename MF::MontgomeryValue
+  call(const MF& mf,
+       const std::array<typename MF::MontgomeryValue, NUM_BASES>& bases,
+       const std::array<typename MF::IntegerType, NUM_BASES>& exponents)
+  {
+    static_assert(NUM_BASES > 0, "");
+    static_assert(0 < TABLE_BITS && TABLE_BITS < 8, "");
+    using T = typename MF::IntegerType;
+    using U = typename extensible_make_unsigned<T>::type;
+    using V = typename MF::MontgomeryValue;
+    using std::size_t;
+
+    constexpr size_t TABLESIZE = static_cast<size_t>(1) << TABLE_BITS;
+    constexpr U MASK = static_cast<U>(TABLESIZE - 1);
+
+    std::array<U, NUM_BASES> n;
+    U n_or = 0;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (size_t i=0; i<NUM_BASES; ++i) {
+        HPBC_CLOCKWORK_PRECONDITION(exponents[i] >= 0);
+        n[i] = static_cast<U>(exponents[i]);
+        n_or = static_cast<U>(n_or | n[i]);
+    }
+    if (n_or == 0)
+        return mf.getUnityValue();
+
+    // table[d][i] == bases[i]^d.  The multiplies for different bases are
+    // independent, and so we use LowuopsTag for them.
+    std::array<std::array<V, NUM_BASES>, TABLESIZE> table;
+    V unity = mf.getUnityValue();
+    HURCHALLA_REQUEST_UNROLL_LOOP for (size_t i=0; i<NUM_BASES; ++i) {
+        table[0][i] = unity;
+        table[1][i] = bases[i];
+    }
+    for (size_t d=2; d<TABLESIZE; ++d) {
+        HURCHALLA_REQUEST_UNROLL_LOOP for (size_t i=0; i<NUM_BASES; ++i) {
+            table[d][i] = (d % 2 == 0)
+                   ? mf.template square<LowuopsTag>(table[d/2][i])
+                   : mf.template multiply<LowuopsTag>(table[d-1][i], bases[i]);
+        }
+    }
+
+    // start at the highest window that contains a set bit of any exponent
+    int numbits = ut_numeric_limits<U>::digits - count_leading_zeros(n_or);
+    HPBC_CLOCKWORK_ASSERT2(numbits > 0);
+    int shift = ((numbits - 1) / TABLE_BITS) * TABLE_BITS;
+
+    V result = table[static_cast<size_t>((n[0] >> shift) & MASK)][0];
+    HURCHALLA_REQUEST_UNROLL_LOOP for (size_t i=1; i<NUM_BASES; ++i) {
+        size_t d = static_cast<size_t>((n[i] >> shift) & MASK);
+        result = mf.template multiply<LowuopsTag>(result, table[d][i]);
+    }
+    while (shift > 0) {
+        shift -= TABLE_BITS;
+        size_t d0 = static_cast<size_t>((n[0] >> shift) & MASK);
+        V prod = table[d0][0];
+        HURCHALLA_REQUEST_UNROLL_LOOP for (size_t i=1; i<NUM_BASES; ++i) {
+            size_t d = static_cast<size_t>((n[i] >> shift) & MASK);
+            prod = mf.template multiply<LowuopsTag>(prod, table[d][i]);
+        }
+        HURCHALLA_REQUEST_UNROLL_LOOP for (int j=0; j<TABLE_BITS; ++j)
+            result = mf.template square<LowlatencyTag>(result);
+        result = mf.template multiply<LowlatencyTag>(result, prod);
+    }
+    return result;
+  }
+};
+
+
+}} // end namespace
+
+#endif
@@ -25,6 +25,18 @@
 namespace hurchalla { namespace detail {
 
 
+// An array-like type whose every element is the same MontgomeryForm mf.  It
+// lets impl_montgomery_two_pow::arraycall() compute 2 to the power of many
+// different exponents with a single modulus, without needing an array of
+// identical copies of mf.
+template <class MF>
+struct SharedMontgomeryFormArray {
+  using value_type = MF;
+  const MF& mf;
+  HURCHALLA_FORCE_INLINE const MF& operator[](std::size_t) const { return mf; }
+};
+
+
 // Implementation notes: this is a highly modified version of the 2^k-ary
 // algorithm  ( https://en.wikipedia.org/wiki/Exponentiation_by_squaring ),
 // taking advantage of the fact that the base is always 2.
@@ -731,13 +743,16 @@ struct impl_montgomery_two_pow {
 #endif
 
 
-  // Array version of montgomery two pow
+  // Array version of montgomery two pow.  MFArray is either
+  // std::array<MF, ARRAY_SIZE> (a separate modulus for each exponent), or
+  // SharedMontgomeryFormArray<MF> (the same modulus for every exponent).
   template <class MF, typename U,
             size_t ARRAY_SIZE, size_t TABLE_BITS, size_t CODE_SECTION,
-            bool USE_SQUARING_VALUE_OPTIMIZATION>
+            bool USE_SQUARING_VALUE_OPTIMIZATION, class MFArray>
   static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  arraycall(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  arraycall(const MFArray& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    static_assert(std::is_same<typename MFArray::value_type, MF>::value, "");
     static_assert(ut_numeric_limits<U>::is_integer, "");
     static_assert(!ut_numeric_limits<U>::is_signed, "");
 
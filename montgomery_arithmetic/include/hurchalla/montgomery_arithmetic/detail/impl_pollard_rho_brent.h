@@ -0,0 +1,164 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_POLLARD_RHO_BRENT_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_POLLARD_RHO_BRENT_H_INCLUDED
+
+
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <array>
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Implementation note: this is Brent's variant of Pollard-Rho (see "An Improved
+// Monte Carlo Factorization Algorithm", BIT 1980), which iterates
+// y = y^2 + c  and accumulates the product q of the differences (x - y), where
+// x is the value of y at the most recent power of 2 iteration.  Each iteration
+// of a single walk depends on the result of the previous iteration, and so a
+// single walk is limited by the latency of the square.  To use the CPU's
+// instruction level parallelism, we run NUM_WALKS independent walks (each with
+// its own c) in lockstep, so that the NUM_WALKS squares of an iteration can
+// execute simultaneously.  Each walk keeps its own product q, since a single
+// shared product would be a dependency chain of NUM_WALKS multiplies per
+// iteration.  At the end of each block of iterations, we multiply the walks'
+// products together and take a single gcd for all walks.
+//
+// Rather than taking a gcd of every difference, we take one gcd of a product
+// of differences per block.  When that gcd is not 1, we need to find which
+// difference caused it, because the product might contain every factor of the
+// modulus.  Instead of recomputing the walk from a saved position (as Brent
+// does), we store the differences of the current block and call the batch
+// gcd_with_modulus(), which finds the first difference whose gcd is not 1.
+// If the product becomes zero, every later product in the block is zero too,
+// so we use multiply()'s resultIsZero to stop the block early.
+//
+// If a walk's first nontrivial gcd is the modulus itself, the walk cycled
+// modulo every factor at once, and it has failed.  This is rare, and we simply
+// restart that walk in place with a new value of c.  The restarted walk keeps
+// the shared schedule of the other walks; this is fine, since the gcd of any
+// difference (x - y) is a valid test for a factor.
+//
+// We use a struct with static member functions to disallow ADL.
+
+template <std::size_t NUM_WALKS>
+struct impl_pollard_rho_brent {
+  static_assert(NUM_WALKS > 0, "");
+
+  // The number of iterations between each gcd.
+  static constexpr std::size_t BLOCK_SIZE = 128;
+
+  // MF must be a MontgomeryForm type, and the modulus of mf must be composite.
+  // Returns a factor f of the modulus, with 1 < f < modulus.
+  template <class MF, class F>
+  static typename MF::IntegerType call(const MF& mf, const F& gcd_functor)
+  {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+    using C = typename MF::CanonicalValue;
+    const T n = mf.getModulus();
+    HPBC_CLOCKWORK_PRECONDITION2(n > 3);
+
+    // the differences of the current block, for each walk
+    std::array<std::array<V, BLOCK_SIZE>, NUM_WALKS> diffs;
+    std::array<C, NUM_WALKS> c;
+    std::array<V, NUM_WALKS> x, y, q;
+    std::array<bool, NUM_WALKS> isZero;
+
+    T next_c = 1;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t w=0; w<NUM_WALKS; ++w) {
+        c[w] = get_c(mf, next_c);
+        y[w] = mf.convertIn(static_cast<T>(2));
+        q[w] = mf.getUnityValue();
+    }
+
+    for (std::size_t r = 1; ; r *= 2) {
+        x = y;
+        for (std::size_t i = 0; i < r; ++i) {
+            HURCHALLA_REQUEST_UNROLL_LOOP
+            for (std::size_t w=0; w<NUM_WALKS; ++w)
+                y[w] = mf.fusedSquareAdd(y[w], c[w]);
+        }
+        for (std::size_t k = 0; k < r; k += BLOCK_SIZE) {
+            std::size_t len = (r - k < BLOCK_SIZE) ? r - k : BLOCK_SIZE;
+            bool anyZero = false;
+            std::size_t i = 0;
+            while (i < len && !anyZero) {
+                HURCHALLA_REQUEST_UNROLL_LOOP
+                for (std::size_t w=0; w<NUM_WALKS; ++w) {
+                    y[w] = mf.fusedSquareAdd(y[w], c[w]);
+                    diffs[w][i] = mf.unorderedSubtract(x[w], y[w]);
+                    q[w] = mf.template multiply<LowuopsTag>(q[w],
+                                                    diffs[w][i], isZero[w]);
+                    anyZero = anyZero || isZero[w];
+                }
+                ++i;
+            }
+            // i is now the number of differences stored in this block.
+            V product = q[0];
+            for (std::size_t w=1; w<NUM_WALKS; ++w)
+                product = mf.multiply(product, q[w]);
+            if (!anyZero && mf.gcd_with_modulus(product, gcd_functor) == 1)
+                continue;
+
+            for (std::size_t w=0; w<NUM_WALKS; ++w) {
+                T g = mf.gcd_with_modulus(q[w], gcd_functor);
+                if (g == 1)
+                    continue;
+                if (g == n) {
+                    // q[w] is zero.  Since the product of the prior blocks
+                    // had a gcd of 1, the first difference with a nontrivial
+                    // gcd is in this block.
+                    std::size_t index;
+                    g = mf.gcd_with_modulus(diffs[w].data(), i, gcd_functor,
+                                            index);
+                    HPBC_CLOCKWORK_ASSERT2(index < i && g != 1);
+                }
+                if (g != n) {
+                    HPBC_CLOCKWORK_POSTCONDITION2(1 < g && g < n);
+                    HPBC_CLOCKWORK_POSTCONDITION2(n % g == 0);
+                    return g;
+                }
+                // this walk failed, so we restart it with a new c.
+                c[w] = get_c(mf, next_c);
+                y[w] = mf.convertIn(static_cast<T>(2));
+                x[w] = y[w];
+                q[w] = mf.getUnityValue();
+            }
+        }
+    }
+  }
+
+ private:
+  // Returns the canonical value of next_c and increments next_c, skipping
+  // the values 0 and -2, which are poor choices for c.
+  template <class MF>
+  static typename MF::CanonicalValue
+  get_c(const MF& mf, typename MF::IntegerType& next_c)
+  {
+    using T = typename MF::IntegerType;
+    using C = typename MF::CanonicalValue;
+    const C zero = mf.getZeroValue();
+    const C negative_two = mf.negate(mf.add(mf.getUnityValue(),
+                                            mf.getUnityValue()));
+    C c;
+    do {
+        c = mf.getCanonicalValue(mf.convertIn(next_c));
+        next_c = static_cast<T>(next_c + 1);
+    } while (c == zero || c == negative_two);
+    return c;
+  }
+};
+
+
+}} // end namespace
+
+#endif
@@ -263,6 +263,46 @@ struct montgomery_pow {
     }
     return result;
   }
+
+  // --------
+  // This array version differs from those above: each base has its own
+  // MontgomeryForm (and thus its own modulus) and its own exponent.  Since the
+  // exponent bits differ between the elements, we can not branch on them, and
+  // so we select the multiplier for each element with a conditional move, as
+  // in scalarpow().  The loop runs until the largest exponent is exhausted;
+  // elements with shorter exponents just multiply by one for the remaining
+  // iterations.  An example application is miller-rabin primality testing of
+  // many different candidate numbers at once.
+  // --------
+  template <std::size_t NUM_BASES, class PTAG>
+  static HURCHALLA_FORCE_INLINE std::array<V, NUM_BASES>
+  arraypow_multiform(const std::array<MF, NUM_BASES>& mf,
+                     std::array<V, NUM_BASES> bases,
+                     std::array<T, NUM_BASES> exponents, PTAG)
+  {
+    T max_exponent = 0;
+    std::array<V, NUM_BASES> result;
+    std::array<V, NUM_BASES> mont_one;
+    HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<NUM_BASES; ++i) {
+        HPBC_CLOCKWORK_PRECONDITION(exponents[i] >= 0);
+        if (max_exponent < exponents[i])
+            max_exponent = exponents[i];
+        mont_one[i] = mf[i].getUnityValue();
+        result[i] = mont_one[i];
+        result[i].cmov((exponents[i] & static_cast<T>(1)), bases[i]);
+    }
+    while (max_exponent > static_cast<T>(1)) {
+        max_exponent = static_cast<T>(max_exponent >> static_cast<T>(1));
+        HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<NUM_BASES; ++i) {
+            exponents[i] = static_cast<T>(exponents[i] >> static_cast<T>(1));
+            bases[i] = mf[i].template square<PTAG>(bases[i]);
+            V tmp = mont_one[i];
+            tmp.cmov((exponents[i] & static_cast<T>(1)), bases[i]);
+            result[i] = mf[i].template multiply<PTAG>(result[i], tmp);
+        }
+    }
+    return result;
+  }
 };
 
 
@@ -424,6 +464,124 @@ struct montgomery_array_pow<MontyTag, MF, typename std::enable_if<
 };
 
 
+
+// Implements MontgomeryForm's static array pow(), which has a separate
+// MontgomeryForm and exponent for each base.
+// Performance note: On x86-64 with gcc, for 4 bases with random exponents of
+// full bit length, arraypow_multiform() had roughly 20-30% higher throughput
+// than calling pow() separately for each base, with TagMontyFullrange and
+// TagMontyQuarterrange.  But with TagMontyHalfrange it was roughly 20% slower,
+// and so for gcc we use separate pow() calls for halfrange.  For types T
+// larger than the native bit width, it was also about 20% slower (see the
+// partial specialization below).
+template<class MontyTag, class MF, class Enable = void>
+struct montgomery_array_pow_multiform {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+
+    template <std::size_t NUM_BASES>
+    static HURCHALLA_FORCE_INLINE std::array<V, NUM_BASES>
+    pow(const std::array<MF, NUM_BASES>& mf,
+        const std::array<V, NUM_BASES>& bases,
+        const std::array<T, NUM_BASES>& exponents)
+    {
+        using PTAG = typename std::conditional<(NUM_BASES < 2), LowlatencyTag, LowuopsTag>::type;
+        return montgomery_pow<MF>::arraypow_multiform(mf, bases, exponents, PTAG());
+    }
+};
+
+template<class MontyTag, class MF>
+struct montgomery_array_pow_multiform_separate {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+
+    template <std::size_t NUM_BASES>
+    static HURCHALLA_FORCE_INLINE std::array<V, NUM_BASES>
+    pow(const std::array<MF, NUM_BASES>& mf,
+        const std::array<V, NUM_BASES>& bases,
+        const std::array<T, NUM_BASES>& exponents)
+    {
+        std::array<V, NUM_BASES> result;
+        for (std::size_t i=0; i<NUM_BASES; ++i) {
+            std::array<V, 1> base = {{ bases[i] }};
+            result[i] = montgomery_array_pow<MontyTag, MF>::pow(mf[i], base,
+                                                           exponents[i])[0];
+        }
+        return result;
+    }
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+template<class MF>
+struct montgomery_array_pow_multiform<TagMontyHalfrange, MF, typename
+            std::enable_if<(ut_numeric_limits<typename MF::IntegerType>::digits
+                            <= HURCHALLA_TARGET_BIT_WIDTH)>::type>
+    : montgomery_array_pow_multiform_separate<TagMontyHalfrange, MF> {};
+#endif
+
+// partial specialization for very large MF::IntegerTypes (e.g. __uint128_t)
+template<class MontyTag, class MF>
+struct montgomery_array_pow_multiform<MontyTag, MF, typename std::enable_if<
+                    (ut_numeric_limits<typename MF::IntegerType>::digits
+                     > HURCHALLA_TARGET_BIT_WIDTH)>::type>
+    : montgomery_array_pow_multiform_separate<MontyTag, MF> {};
+
+
+
+// Implements MontgomeryForm's pow() for a runtime count of bases.  We tile the
+// bases into chunks of a fixed size CHUNK and call montgomery_array_pow on each
+// chunk, and then handle the final partial chunk (if any) with one call using
+// the exact remaining size.  This keeps every std::array small, so that the
+// compiler can keep the chunk in registers.
+template<class MontyTag, class MF>
+struct montgomery_array_pow_runtime {
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+
+    // On x86-64 (gcc), a chunk of 4 or 5 bases was close to the best we could
+    // get for native sized T, with little further gain at 6 or more.  For T
+    // larger than native (e.g. __uint128_t), throughput was nearly flat from 4
+    // bases upward.  As noted for MontgomeryForm's array pow(), when two sizes
+    // perform similarly we prefer the smaller size, to save i-cache.
+    static constexpr std::size_t CHUNK =
+           (ut_numeric_limits<T>::digits > HURCHALLA_TARGET_BIT_WIDTH) ? 4 : 5;
+
+ private:
+    template <std::size_t N>
+    static HURCHALLA_FORCE_INLINE
+    void pow_block(const MF& mf, V* HURCHALLA_RESTRICT result,
+                   const V* HURCHALLA_RESTRICT bases, T exponent)
+    {
+        std::array<V, N> b;
+        HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t j = 0; j < N; ++j)
+            b[j] = bases[j];
+        std::array<V, N> r =
+                       montgomery_array_pow<MontyTag, MF>::pow(mf, b, exponent);
+        HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t j = 0; j < N; ++j)
+            result[j] = r[j];
+    }
+
+ public:
+    static void pow(const MF& mf, V* HURCHALLA_RESTRICT result,
+                    const V* HURCHALLA_RESTRICT bases, std::size_t count,
+                    T exponent)
+    {
+        static_assert(2 <= CHUNK && CHUNK <= 5, "");
+        std::size_t i = 0;
+        for (; count - i >= CHUNK; i += CHUNK)
+            pow_block<CHUNK>(mf, result + i, bases + i, exponent);
+        switch (count - i) {
+            case 4: pow_block<4>(mf, result + i, bases + i, exponent); break;
+            case 3: pow_block<3>(mf, result + i, bases + i, exponent); break;
+            case 2: pow_block<2>(mf, result + i, bases + i, exponent); break;
+            case 1: pow_block<1>(mf, result + i, bases + i, exponent); break;
+            default: HPBC_CLOCKWORK_ASSERT2(count - i == 0);
+        }
+    }
+};
+
+
 }} // end namespace
 
 #endif
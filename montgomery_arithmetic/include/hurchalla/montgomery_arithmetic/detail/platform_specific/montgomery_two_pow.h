@@ -55,6 +55,9 @@ struct tagged_montgomery_two_pow {};
 //  template <class MF, typename U,
 //            size_t ARRAY_SIZE, size_t TABLE_BITS, size_t CODE_SECTION,
 //            bool USE_SQUARING_VALUE_OPTIMIZATION>
+//
+// The array calls below take an MFA, which is either std::array<MF,ARRAY_SIZE>
+// or SharedMontgomeryFormArray<MF>.
 
 
 // ARM64
@@ -76,10 +79,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // favor asm results, best compromise is using 34.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 34, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 31 best.  30 trails ~0.15% with asm, and trails ~0.6% with no asm
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -94,10 +98,11 @@ template <> struct tagged_montgomery_two_pow
     // false 0 34 false clear winner
     return impl_montgomery_two_pow::call<MF, U, false, 0, 34, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // slightly prefer 0 31 false due to tiny bit better on asm.  Very close to a
     // toss-up with 0 30 false.
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
@@ -114,10 +119,11 @@ template <> struct tagged_montgomery_two_pow
     // loses by ~0.7% on noasm)
     return impl_montgomery_two_pow::call<MF, U, false, 0, 34, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0, 31, false best.  It's ~2.5% faster than 30 for asm (and 1% faster
     // than 29), though ~1.5% slower than 30 with noasm.
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
@@ -139,10 +145,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // to help noasm- for asm, it is ~0.5% slower than asm best.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 22, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 31 false prefered.  0 30 false trails by ~0.4% with asm, and leads by
     // ~0.25% with noasm.  Note that for noasm, 0 30 true leads by ~4.5% over
     // 0 30 false; however using true loses ~6% perf with asm, so it would be a
@@ -161,10 +168,11 @@ template <> struct tagged_montgomery_two_pow
     // and ~0.6% slower with noasm
     return impl_montgomery_two_pow::call<MF, U, false, 0, 22, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // Use 0 31 false:
     // We slightly prefer 31 for asm (very close to toss-up with 30), and 31 is
     // ~2% faster than 30 with noasm.
@@ -182,10 +190,11 @@ template <> struct tagged_montgomery_two_pow
     // on asm but 0.45% faster than 22 with noasm.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 22, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 31 false wins.  It's a tiny bit better on asm than 30 (almost a toss-
     // up) and very roughly over 1% faster than 30 on noasm.
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
@@ -209,10 +218,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // For consistency we'll choose 23 since it's used elsewhere and 21 is not.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 23, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 31 false best, both asm, noasm
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -228,10 +238,11 @@ template <> struct tagged_montgomery_two_pow
     // and loses ~0.1% at noasm).  35 would be next best choice
     return impl_montgomery_two_pow::call<MF, U, false, 0, 25, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 31 preferred, but 29 wins at biggest array sizes by ~0.25% - 0.5%.  So 29
     // is fine too (it loses by larger margins at smaller sizes).
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 29, false>(mf, n);
@@ -247,10 +258,11 @@ template <> struct tagged_montgomery_two_pow
     // 23 best, 35 next best and is 0.2-0.4% slower
     return impl_montgomery_two_pow::call<MF, U, false, 0, 23, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 31 wins overall, 29 very close and arguably wins with noasm.
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -269,10 +281,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // with noasm too.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 23, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 29 false and 31 equally good.  for absolute perf 31 wins by 0.1 - 0.5%,
     // at cost of biggest array sizes.  29 wins at smaller sizes by a larger
     // margin (around 0.5% - 1%, and up to 2%).
@@ -289,10 +302,11 @@ template <> struct tagged_montgomery_two_pow
     // 25 best, though 37 behind only 0.1 - 0.25%
     return impl_montgomery_two_pow::call<MF, U, false, 0, 25, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0, 28, false wins.  30 fine too though a bit slower
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 28, false>(mf, n);
   }
@@ -307,10 +321,11 @@ template <> struct tagged_montgomery_two_pow
     // 37 wins, 25 second place - 0.2% slower.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 37, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 29 seems best (it wins at biggest array sizes), but it's not completely
     // clear what's best overall.  28 seems best overall if you favor small
     // array sizes.
@@ -338,10 +353,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // x t 0 41 best.  x x 0 41 also arguable, since it has absolute best time
     return impl_montgomery_two_pow::call<MF, U, false, 0, 41, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 31 x best.  28 second place
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -356,10 +372,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 41  best
     return impl_montgomery_two_pow::call<MF, U, false, 0, 41, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 31 x best, 30 pretty close second
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -374,10 +391,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 41 clear winner.  40 or 39 or 11 maybe second.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 41, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 30 x best.  31 extremely close second.
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -395,10 +413,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // x t 0 29 clear winner.  x t 0 41 clear second place
     return impl_montgomery_two_pow::call<MF, U, false, 0, 29, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 31 x clear winner.  29 clear second place
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -413,10 +432,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 29 clear winner
     return impl_montgomery_two_pow::call<MF, U, false, 0, 29, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 31 x clear winner
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 31, false>(mf, n);
   }
@@ -431,10 +451,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 41 clear winner
     return impl_montgomery_two_pow::call<MF, U, false, 0, 41, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 29 or 31 best, though 30 arguably better since it has absolute best time
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 29, false>(mf, n);
   }
@@ -453,10 +474,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // x 0 23 t clear winner.  35 probably second place but not so clearly.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 23, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 29 ~3% slower
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 28, false>(mf, n);
   }
@@ -471,10 +493,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 6 clear winner.  x x 0 23 about 2% slower if I can't use 0 6.
     return impl_montgomery_two_pow::call<MF, U, false, 0, 6, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 29 clear winner asm (though 28 ~2% better than 29 on noasm)
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 29, false>(mf, n);
   }
@@ -489,10 +512,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 23 clear winner.  24 or 25 second place
     return impl_montgomery_two_pow::call<MF, U, false, 0, 23, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 28 x seems best, though 29 is close enough to be a near toss-up
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 28, false>(mf, n);
   }
@@ -510,10 +534,11 @@ template <class MontyTag> struct tagged_montgomery_two_pow
     // x t 0 23 clear winner
     return impl_montgomery_two_pow::call<MF, U, false, 0, 23, true>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 29 x best.  31 very close second
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 29, false>(mf, n);
   }
@@ -528,10 +553,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 6 seems best, but 0 5 could also be arguable as best
     return impl_montgomery_two_pow::call<MF, U, false, 0, 6, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 29 x clear winner
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 29, false>(mf, n);
   }
@@ -546,10 +572,11 @@ template <> struct tagged_montgomery_two_pow
     // x x 0 6  clearly wins.  either  x x 0 23  or  35  is second place
     return impl_montgomery_two_pow::call<MF, U, false, 0, 6, false>(mf, n);
   }
-  template <class MF, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  call(const std::array<MF, ARRAY_SIZE>& mf, const std::array<U, ARRAY_SIZE>& n)
+  template <class MFA, typename U, std::size_t ARRAY_SIZE> HURCHALLA_FORCE_INLINE
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  call(const MFA& mf, const std::array<U, ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     // 0 29 x clearly wins
     return impl_montgomery_two_pow::arraycall<MF, U, ARRAY_SIZE, 0, 29, false>(mf, n);
   }
@@ -591,12 +618,14 @@ struct montgomery_two_pow {
   }
 
 
-  // Helper function - delegated Array version of montgomery two pow
-  template <class MF, typename U, std::size_t ARRAY_SIZE>
+  // Helper function - delegated Array version of montgomery two pow.
+  // MFA is either std::array<MF,ARRAY_SIZE> or SharedMontgomeryFormArray<MF>.
+  template <class MFA, typename U, std::size_t ARRAY_SIZE>
   HURCHALLA_FORCE_INLINE
-  static std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
-  helper(const std::array<MF,ARRAY_SIZE>& mf, const std::array<U,ARRAY_SIZE>& n)
+  static std::array<typename MFA::value_type::MontgomeryValue, ARRAY_SIZE>
+  helper(const MFA& mf, const std::array<U,ARRAY_SIZE>& n)
   {
+    using MF = typename MFA::value_type;
     static_assert(hurchalla::ut_numeric_limits<U>::is_integer, "");
     static_assert(!hurchalla::ut_numeric_limits<U>::is_signed, "");
 
@@ -643,6 +672,39 @@ struct montgomery_two_pow {
       }
       return helper(mf, n);
   }
+
+
+  // Array version of montgomery two pow, with a single MontgomeryForm (and
+  // thus a single modulus) shared by every exponent, for unsigned T
+  template <class MF, typename T, std::size_t ARRAY_SIZE>
+  HURCHALLA_FORCE_INLINE static
+  typename std::enable_if<!(hurchalla::ut_numeric_limits<T>::is_signed),
+                          std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
+                          >::type
+  call(const MF& mf, const std::array<T,ARRAY_SIZE>& nt)
+  {
+      SharedMontgomeryFormArray<MF> smf = { mf };
+      return helper(smf, nt);
+  }
+
+  // Array version of montgomery two pow, with a single MontgomeryForm (and
+  // thus a single modulus) shared by every exponent, for signed T
+  template <class MF, typename T, std::size_t ARRAY_SIZE>
+  HURCHALLA_FORCE_INLINE static
+  typename std::enable_if<(hurchalla::ut_numeric_limits<T>::is_signed),
+                          std::array<typename MF::MontgomeryValue, ARRAY_SIZE>
+                          >::type
+  call(const MF& mf, const std::array<T,ARRAY_SIZE>& nt)
+  {
+      using U = typename extensible_make_unsigned<T>::type;
+      std::array<U, ARRAY_SIZE> n;
+      HURCHALLA_REQUEST_UNROLL_LOOP for (std::size_t i=0; i<ARRAY_SIZE; ++i) {
+        HPBC_CLOCKWORK_PRECONDITION(nt[i] >= 0);
+        n[i] = static_cast<U>(nt[i]);
+      }
+      SharedMontgomeryFormArray<MF> smf = { mf };
+      return helper(smf, n);
+  }
 };
 
 
@@ -0,0 +1,72 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IS_PRIME_BPSW_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IS_PRIME_BPSW_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/impl_is_prime_bpsw.h"
+#include "hurchalla/util/traits/extensible_make_unsigned.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+
+namespace hurchalla {
+
+
+// Returns true if x is prime, and otherwise returns false, using the
+// Baillie-PSW test: a base 2 strong probable prime test followed by a strong
+// Lucas probable prime test with Selfridge's parameters.  T can be any
+// integral type up to 128 bits (including __uint128_t and __int128_t).
+//
+// The result is proven correct for every x below 2^64.  For larger x, no
+// composite number is known that passes the test, although it is conjectured
+// that such composites exist.
+//
+// Performance note: a prime must pass every base of is_prime_miller_rabin(),
+// whereas here it needs the base 2 test and a Lucas test that costs about as
+// much as two bases.  So for x above 2^64 (where is_prime_miller_rabin uses 13
+// bases) this function is about twice as fast for primes, and for x below
+// 2^32 (where it uses 3 bases) it is slower for primes.  For composites it is
+// usually faster at any size, since most composites fail its single base 2
+// test, while is_prime_miller_rabin tests its first group of bases together.
+//
+// Internally, this chooses the fastest MontgomeryForm type that can support x
+// and it uses the smallest integer type that can hold x, like
+// is_prime_miller_rabin().
+template <typename T>
+bool is_prime_bpsw(T x)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(ut_numeric_limits<T>::digits <= 128, "");
+    HPBC_CLOCKWORK_API_PRECONDITION(x >= 0);
+    using U = typename extensible_make_unsigned<T>::type;
+    return detail::impl_is_prime_bpsw::call(static_cast<U>(x));
+}
+
+
+// Returns true if x is a strong Lucas probable prime, using Selfridge's
+// parameters (D is the first of 5, -7, 9, -11, ... with Jacobi symbol
+// (D/x) == -1, P = 1, and Q = (1 - D)/4).  Every prime passes this test, and
+// composites that pass it are called strong Lucas pseudoprimes.  Perfect
+// squares and even numbers other than 2 never pass.  This is the second half
+// of is_prime_bpsw(); by itself it is mostly useful if you have already
+// applied a base 2 strong probable prime test to x, for example with
+// BatchPrpFilter.
+template <typename T>
+bool is_strong_lucas_probable_prime(T x)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(ut_numeric_limits<T>::digits <= 128, "");
+    HPBC_CLOCKWORK_API_PRECONDITION(x >= 0);
+    using U = typename extensible_make_unsigned<T>::type;
+    return detail::impl_is_prime_bpsw::call_lucas(static_cast<U>(x));
+}
+
+
+} // end namespace
+
+#endif
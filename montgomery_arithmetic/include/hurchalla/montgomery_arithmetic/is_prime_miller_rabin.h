@@ -0,0 +1,55 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IS_PRIME_MILLER_RABIN_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IS_PRIME_MILLER_RABIN_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/impl_is_prime_miller_rabin.h"
+#include "hurchalla/util/traits/extensible_make_unsigned.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+
+namespace hurchalla {
+
+
+// Returns true if x is prime, and otherwise returns false.  T can be any
+// integral type up to 128 bits (including __uint128_t and __int128_t).
+//
+// This uses the Miller-Rabin test, with a set of bases that is known to give
+// the correct answer for every x below 2^64.  For larger x (possible only if T
+// is a 128 bit type), the result is proven correct for x less than
+// 3317044064679887385961981 (about 2^81.5).  Above that bound, a true result
+// means that x is a strong probable prime to the first 13 prime bases; no
+// composite number is known that passes this test, but none has been proven
+// not to exist.
+// For x above 2^64, is_prime_bpsw() is usually a faster choice.
+//
+// Internally, this chooses the fastest MontgomeryForm type that can support x
+// (MontgomeryQuarter, MontgomeryHalf, or MontgomeryFull), and it uses the
+// smallest integer type that can hold x, so that for example a small x in a
+// __uint128_t is tested with 64 bit or 32 bit arithmetic.
+//
+// Performance note: for most composites this function takes far less time
+// than for primes, since most composites fail the first group of bases.  If
+// you test many numbers that may have small factors, you will probably get
+// better performance by first sieving them or checking them with trial
+// division.
+template <typename T>
+bool is_prime_miller_rabin(T x)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(ut_numeric_limits<T>::digits <= 128, "");
+    HPBC_CLOCKWORK_API_PRECONDITION(x >= 0);
+    using U = typename extensible_make_unsigned<T>::type;
+    return detail::impl_is_prime_miller_rabin::call(static_cast<U>(x));
+}
+
+
+} // end namespace
+
+#endif
@@ -10,12 +10,14 @@
 
 
 #include "hurchalla/montgomery_arithmetic/low_level_api/detail/platform_specific/ImplRedc.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/detail/platform_specific/impl_array_REDC.h"
 #include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
 #include "hurchalla/util/traits/safely_promote_unsigned.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
 #include "hurchalla/util/compiler_macros.h"
 #include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
 #include <type_traits>
+#include <cstddef>
 
 #if defined(_MSC_VER)
 #  pragma warning(push)
@@ -227,6 +229,128 @@ T REDC_incomplete(T u_hi, T u_lo, T n, T inv_n, PTAG)
 }
 
 
+
+// Array versions of REDC_standard() and REDC_incomplete().
+//
+// For each index i from 0 to count-1, these functions compute the same result
+// as the corresponding single value function above would compute when given
+// u_hi[i], u_lo[i], n[i], and inv_n[i].  The preconditions are likewise the
+// same as above, for each index i.  The output arrays must not overlap with
+// any of the input arrays or with each other.
+// Since every REDC in the arrays is independent of the others, these functions
+// can overlap the multiply latencies of many REDCs, and for some types T and
+// target instruction sets they perform the REDCs with SIMD instructions (see
+// impl_array_REDC.h).  When you have many REDCs to perform, you can expect
+// these functions to provide throughput at least as good as, and often better
+// than, a loop that calls the single value functions.
+template <typename T, class PTAG>
+void REDC_standard(T* HURCHALLA_RESTRICT result,
+                   const T* HURCHALLA_RESTRICT u_hi,
+                   const T* HURCHALLA_RESTRICT u_lo,
+                   const T* HURCHALLA_RESTRICT n,
+                   const T* HURCHALLA_RESTRICT inv_n,
+                   std::size_t count, PTAG)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<T>::is_modulo, "");
+
+    using P = typename safely_promote_unsigned<T>::type;
+    if (HPBC_CLOCKWORK_PRECONDITION2_MACRO_IS_ACTIVE) {
+        for (std::size_t i = 0; i < count; ++i) {
+            HPBC_CLOCKWORK_PRECONDITION2(n[i] % 2 == 1);
+            HPBC_CLOCKWORK_PRECONDITION2(n[i] > 1);
+            HPBC_CLOCKWORK_PRECONDITION2(static_cast<T>(static_cast<P>(n[i]) *
+                                             static_cast<P>(inv_n[i])) == 1);
+            HPBC_CLOCKWORK_PRECONDITION2(u_hi[i] < n[i]);
+        }
+    }
+
+    detail::impl_array_REDC::standard(result, u_hi, u_lo, n, inv_n, count,
+                                      PTAG());
+
+    if (HPBC_CLOCKWORK_POSTCONDITION2_MACRO_IS_ACTIVE) {
+        for (std::size_t i = 0; i < count; ++i)
+            HPBC_CLOCKWORK_POSTCONDITION2(result[i] == ::hurchalla::
+                  REDC_standard(u_hi[i], u_lo[i], n[i], inv_n[i], PTAG()));
+    }
+}
+
+template <typename T, class PTAG>
+void REDC_incomplete(T* HURCHALLA_RESTRICT minuend,
+                     T* HURCHALLA_RESTRICT subtrahend,
+                     const T* HURCHALLA_RESTRICT u_hi,
+                     const T* HURCHALLA_RESTRICT u_lo,
+                     const T* HURCHALLA_RESTRICT n,
+                     const T* HURCHALLA_RESTRICT inv_n,
+                     std::size_t count, PTAG)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<T>::is_modulo, "");
+
+    using P = typename safely_promote_unsigned<T>::type;
+    if (HPBC_CLOCKWORK_PRECONDITION2_MACRO_IS_ACTIVE) {
+        for (std::size_t i = 0; i < count; ++i) {
+            HPBC_CLOCKWORK_PRECONDITION2(n[i] % 2 == 1);
+            HPBC_CLOCKWORK_PRECONDITION2(n[i] > 1);
+            HPBC_CLOCKWORK_PRECONDITION2(static_cast<T>(static_cast<P>(n[i]) *
+                                             static_cast<P>(inv_n[i])) == 1);
+            HPBC_CLOCKWORK_PRECONDITION2(u_hi[i] < n[i]);
+        }
+    }
+
+    detail::impl_array_REDC::incomplete(minuend, subtrahend, u_hi, u_lo, n,
+                                        inv_n, count, PTAG());
+
+    if (HPBC_CLOCKWORK_POSTCONDITION2_MACRO_IS_ACTIVE) {
+        for (std::size_t i = 0; i < count; ++i) {
+            T diff = static_cast<T>(minuend[i] - subtrahend[i]);
+            T finalized_result = (minuend[i] < subtrahend[i]) ?
+                                          static_cast<T>(diff + n[i]) : diff;
+            HPBC_CLOCKWORK_POSTCONDITION2(finalized_result == ::hurchalla::
+                  REDC_standard(u_hi[i], u_lo[i], n[i], inv_n[i], PTAG()));
+        }
+    }
+}
+
+template <typename T, class PTAG>
+void REDC_incomplete(T* HURCHALLA_RESTRICT result,
+                     const T* HURCHALLA_RESTRICT u_hi,
+                     const T* HURCHALLA_RESTRICT u_lo,
+                     const T* HURCHALLA_RESTRICT n,
+                     const T* HURCHALLA_RESTRICT inv_n,
+                     std::size_t count, PTAG)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<T>::is_modulo, "");
+
+    using P = typename safely_promote_unsigned<T>::type;
+    if (HPBC_CLOCKWORK_PRECONDITION2_MACRO_IS_ACTIVE) {
+        for (std::size_t i = 0; i < count; ++i) {
+            HPBC_CLOCKWORK_PRECONDITION2(n[i] % 2 == 1);
+            HPBC_CLOCKWORK_PRECONDITION2(n[i] > 1);
+            HPBC_CLOCKWORK_PRECONDITION2(static_cast<T>(static_cast<P>(n[i]) *
+                                             static_cast<P>(inv_n[i])) == 1);
+            HPBC_CLOCKWORK_PRECONDITION2(u_hi[i] < n[i]);
+        }
+    }
+
+    detail::impl_array_REDC::incomplete(result, u_hi, u_lo, n, inv_n, count,
+                                        PTAG());
+
+    if (HPBC_CLOCKWORK_POSTCONDITION2_MACRO_IS_ACTIVE) {
+        for (std::size_t i = 0; i < count; ++i) {
+            T complete_result = ::hurchalla::REDC_standard(u_hi[i], u_lo[i],
+                                                     n[i], inv_n[i], PTAG());
+            HPBC_CLOCKWORK_POSTCONDITION2(result[i] == complete_result ||
+                        static_cast<T>(result[i] + n[i]) == complete_result);
+        }
+    }
+}
+
+
 } // end namespace
 
 
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_ARRAY_INVERSE_MOD_R_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_ARRAY_INVERSE_MOD_R_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/low_level_api/detail/impl_inverse_mod_R.h"
+#include "hurchalla/util/traits/safely_promote_unsigned.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/sized_uint.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <type_traits>
+#include <cstddef>
+
+namespace hurchalla { namespace detail {
+
+
+// Computes the inverse (mod R) of every element of an array.  See
+// impl_inverse_mod_R.h for the algorithms.
+//
+// For the native integer types, every element uses Dumas' algorithm, and the
+// loop over elements has no dependencies between iterations, so compilers can
+// vectorize it (each iteration is only a handful of multiplies).  For types
+// larger than the native bit width, we process the array in blocks: first we
+// compute the half-width inverses of a block via a recursive call (which for
+// __uint128_t is the vectorizable uint64_t case), and then we perform the
+// Newton step for every element of the block.  The Newton steps of different
+// elements are independent, so the CPU can overlap them rather than waiting
+// on the latency of each one in turn.
+
+// minor note: we use static member functions to disallow ADL.
+
+struct impl_array_inverse_mod_R {
+#ifndef HURCHALLA_TARGET_BIT_WIDTH
+#  error "HURCHALLA_TARGET_BIT_WIDTH must be defined"
+#endif
+    template <typename T, int bits>
+    static HURCHALLA_FORCE_INLINE
+    typename std::enable_if<(bits <= HURCHALLA_TARGET_BIT_WIDTH), void>::type
+    call(T* HURCHALLA_RESTRICT result, const T* HURCHALLA_RESTRICT a,
+         std::size_t count)
+    {
+        static_assert(ut_numeric_limits<T>::is_integer, "");
+        static_assert(!(ut_numeric_limits<T>::is_signed), "");
+        static_assert(bits == ut_numeric_limits<T>::digits, "");
+        for (std::size_t i=0; i<count; ++i)
+            result[i] = impl_inverse_mod_R::call<T, bits>(a[i]);
+    }
+
+    template <typename T, int bits>
+    static HURCHALLA_FORCE_INLINE
+    typename std::enable_if<!(bits <= HURCHALLA_TARGET_BIT_WIDTH), void>::type
+    call(T* HURCHALLA_RESTRICT result, const T* HURCHALLA_RESTRICT a,
+         std::size_t count)
+    {
+        static_assert(ut_numeric_limits<T>::is_integer, "");
+        static_assert(!(ut_numeric_limits<T>::is_signed), "");
+        static_assert((bits/2)*2 == bits, "");
+        constexpr bool is_valid_su = is_valid_sized_uint<bits/2>::value;
+        static_assert(is_valid_su, "");
+        using T2 = typename sized_uint<bits/2>::type;
+        using P = typename safely_promote_unsigned<T>::type;
+
+        // The block size is small enough that the two half-width arrays fit
+        // comfortably on the stack and in L1 cache.
+        constexpr std::size_t BLOCK = 64;
+        T2 a_lo[BLOCK];
+        T2 x_lo[BLOCK];
+        for (std::size_t start=0; start<count; start+=BLOCK) {
+            std::size_t len = (count - start < BLOCK) ? count - start : BLOCK;
+            for (std::size_t j=0; j<len; ++j)
+                a_lo[j] = static_cast<T2>(a[start + j]);
+            // set x_lo so that all its bits are good (the lower half of the
+            // bits of the full inverse).
+            call<T2, bits/2>(x_lo, a_lo, len);
+            // use one step of the standard newtons method algorithm for the
+            // inverse to double the number of good bits.
+            for (std::size_t j=0; j<len; ++j) {
+                T x = static_cast<T>(x_lo[j]);
+                result[start + j] = static_cast<T>(x *
+                                     (2 - static_cast<P>(a[start + j])*x));
+            }
+        }
+    }
+};
+
+
+}} // end namespace
+
+#endif
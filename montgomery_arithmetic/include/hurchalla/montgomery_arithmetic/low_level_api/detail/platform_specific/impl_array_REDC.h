@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_ARRAY_REDC_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_IMPL_ARRAY_REDC_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/low_level_api/detail/platform_specific/ImplRedc.h"
+#include "hurchalla/modular_arithmetic/detail/optimization_tag_structs.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstddef>
+#include <cstdint>
+
+// When the compiler targets AVX-512F, we compute eight 64 bit REDCs at once
+// with the kernel below.  You can define HURCHALLA_DISALLOW_AVX512F to prevent
+// this.
+#if defined(__AVX512F__) && !defined(HURCHALLA_DISALLOW_AVX512F)
+#  define HURCHALLA_ARRAY_REDC_USES_AVX512 1
+#  include <immintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4127)
+#endif
+
+namespace hurchalla { namespace detail {
+
+
+// Array versions of the REDC functions in ImplRedc.h.
+//
+// Every element is independent of the others, so the CPU can overlap the
+// dependent multiplies (u_lo*inv_n, and then m*n) of many REDCs at once,
+// rather than serializing on their latency.  The arrays are restrict
+// qualified, which lets the compiler vectorize the generic loops when T is
+// small enough for the target's SIMD integer multiply (e.g. uint32_t with
+// AVX2 or AVX-512).  No SIMD instruction set has a 64x64->128 bit multiply,
+// so compilers do not vectorize the uint64_t loops; for uint64_t we provide an
+// explicit AVX-512F kernel that builds the needed products from 32x32->64 bit
+// multiplies.
+
+
+// Kernels that process as many leading elements as they can, and return the
+// number of elements processed.  The primary template processes none.
+template <typename T>
+struct ArrayRedcKernel {
+  template <class PTAG> static HURCHALLA_FORCE_INLINE
+  std::size_t standard(T*, const T*, const T*, const T*, const T*,
+                       std::size_t, PTAG)
+  { return 0; }
+
+  template <class PTAG> static HURCHALLA_FORCE_INLINE
+  std::size_t incomplete(T*, const T*, const T*, const T*, const T*,
+                         std::size_t, PTAG)
+  { return 0; }
+
+  template <class PTAG> static HURCHALLA_FORCE_INLINE
+  std::size_t incomplete(T*, T*, const T*, const T*, const T*, const T*,
+                         std::size_t, PTAG)
+  { return 0; }
+};
+
+#ifdef HURCHALLA_ARRAY_REDC_USES_AVX512
+template <>
+struct ArrayRedcKernel<std::uint64_t> {
+ private:
+  using U = std::uint64_t;
+  // Returns the high 64 bits of each 128 bit lane product m*n, using
+  // m*n == m1*n1*2^64 + (m1*n0 + m0*n1)*2^32 + m0*n0.
+  static HURCHALLA_FORCE_INLINE __m512i mulhi(__m512i m, __m512i n)
+  {
+    __m512i m1 = _mm512_srli_epi64(m, 32);
+    __m512i n1 = _mm512_srli_epi64(n, 32);
+    __m512i p00 = _mm512_mul_epu32(m, n);
+    __m512i p01 = _mm512_mul_epu32(m, n1);
+    __m512i p10 = _mm512_mul_epu32(m1, n);
+    __m512i p11 = _mm512_mul_epu32(m1, n1);
+    __m512i lomask = _mm512_set1_epi64(0xFFFFFFFF);
+    // mid < 3*2^32, so it can't overflow
+    __m512i mid = _mm512_add_epi64(_mm512_srli_epi64(p00, 32),
+                                   _mm512_and_si512(p01, lomask));
+    mid = _mm512_add_epi64(mid, _mm512_and_si512(p10, lomask));
+    __m512i hi = _mm512_add_epi64(p11, _mm512_srli_epi64(p01, 32));
+    hi = _mm512_add_epi64(hi, _mm512_srli_epi64(p10, 32));
+    return _mm512_add_epi64(hi, _mm512_srli_epi64(mid, 32));
+  }
+  // Returns the low 64 bits of each lane product a*b.
+  static HURCHALLA_FORCE_INLINE __m512i mullo(__m512i a, __m512i b)
+  {
+    __m512i cross = _mm512_add_epi64(
+                     _mm512_mul_epu32(a, _mm512_srli_epi64(b, 32)),
+                     _mm512_mul_epu32(_mm512_srli_epi64(a, 32), b));
+    return _mm512_add_epi64(_mm512_mul_epu32(a, b),
+                            _mm512_slli_epi64(cross, 32));
+  }
+  // Computes the REDC subtrahend mn_hi for 8 elements; see
+  // RedcIncomplete::call() in ImplRedc.h.
+  static HURCHALLA_FORCE_INLINE
+  __m512i subtrahend8(const U* u_lo, const U* n, const U* inv_n)
+  {
+    __m512i m = mullo(_mm512_loadu_si512(u_lo), _mm512_loadu_si512(inv_n));
+    return mulhi(m, _mm512_loadu_si512(n));
+  }
+
+ public:
+  template <class PTAG> static HURCHALLA_FORCE_INLINE
+  std::size_t standard(U* HURCHALLA_RESTRICT result,
+                       const U* HURCHALLA_RESTRICT u_hi,
+                       const U* HURCHALLA_RESTRICT u_lo,
+                       const U* HURCHALLA_RESTRICT n,
+                       const U* HURCHALLA_RESTRICT inv_n,
+                       std::size_t count, PTAG)
+  {
+    std::size_t end = count - count % 8;
+    for (std::size_t i = 0; i < end; i += 8) {
+        __m512i mn_hi = subtrahend8(u_lo + i, n + i, inv_n + i);
+        __m512i vu_hi = _mm512_loadu_si512(u_hi + i);
+        __m512i diff = _mm512_sub_epi64(vu_hi, mn_hi);
+        __mmask8 borrow = _mm512_cmplt_epu64_mask(vu_hi, mn_hi);
+        diff = _mm512_mask_add_epi64(diff, borrow, diff,
+                                     _mm512_loadu_si512(n + i));
+        _mm512_storeu_si512(result + i, diff);
+    }
+    return end;
+  }
+
+  template <class PTAG> static HURCHALLA_FORCE_INLINE
+  std::size_t incomplete(U* HURCHALLA_RESTRICT result,
+                         const U* HURCHALLA_RESTRICT u_hi,
+                         const U* HURCHALLA_RESTRICT u_lo,
+                         const U* HURCHALLA_RESTRICT n,
+                         const U* HURCHALLA_RESTRICT inv_n,
+                         std::size_t count, PTAG)
+  {
+    std::size_t end = count - count % 8;
+    for (std::size_t i = 0; i < end; i += 8) {
+        __m512i mn_hi = subtrahend8(u_lo + i, n + i, inv_n + i);
+        __m512i vu_hi = _mm512_loadu_si512(u_hi + i);
+        _mm512_storeu_si512(result + i, _mm512_sub_epi64(vu_hi, mn_hi));
+    }
+    return end;
+  }
+
+  template <class PTAG> static HURCHALLA_FORCE_INLINE
+  std::size_t incomplete(U* HURCHALLA_RESTRICT minuend,
+                         U* HURCHALLA_RESTRICT subtrahend,
+                         const U* HURCHALLA_RESTRICT u_hi,
+                         const U* HURCHALLA_RESTRICT u_lo,
+                         const U* HURCHALLA_RESTRICT n,
+                         const U* HURCHALLA_RESTRICT inv_n,
+                         std::size_t count, PTAG)
+  {
+    std::size_t end = count - count % 8;
+    for (std::size_t i = 0; i < end; i += 8) {
+        __m512i mn_hi = subtrahend8(u_lo + i, n + i, inv_n + i);
+        _mm512_storeu_si512(minuend + i, _mm512_loadu_si512(u_hi + i));
+        _mm512_storeu_si512(subtrahend + i, mn_hi);
+    }
+    return end;
+  }
+};
+#endif
+
+
+// Minor note: uses static member functions to disallow ADL.
+struct impl_array_REDC {
+  template <typename T, class PTAG>
+  static HURCHALLA_FORCE_INLINE
+  void standard(T* HURCHALLA_RESTRICT result,
+                const T* HURCHALLA_RESTRICT u_hi,
+                const T* HURCHALLA_RESTRICT u_lo,
+                const T* HURCHALLA_RESTRICT n,
+                const T* HURCHALLA_RESTRICT inv_n,
+                std::size_t count, PTAG)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    std::size_t i = ArrayRedcKernel<T>::standard(result, u_hi, u_lo, n,
+                                                 inv_n, count, PTAG());
+    for (; i < count; ++i) {
+        result[i] = RedcStandard<T>::call(u_hi[i], u_lo[i], n[i], inv_n[i],
+                                          PTAG());
+    }
+  }
+
+  // Computes result[i] = minuend - subtrahend, without adding n when the
+  // difference is negative.
+  template <typename T, class PTAG>
+  static HURCHALLA_FORCE_INLINE
+  void incomplete(T* HURCHALLA_RESTRICT result,
+                  const T* HURCHALLA_RESTRICT u_hi,
+                  const T* HURCHALLA_RESTRICT u_lo,
+                  const T* HURCHALLA_RESTRICT n,
+                  const T* HURCHALLA_RESTRICT inv_n,
+                  std::size_t count, PTAG)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    std::size_t i = ArrayRedcKernel<T>::incomplete(result, u_hi, u_lo, n,
+                                                   inv_n, count, PTAG());
+    for (; i < count; ++i) {
+        result[i] = RedcIncomplete::call(u_hi[i], u_lo[i], n[i], inv_n[i],
+                                         PTAG());
+    }
+  }
+
+  template <typename T, class PTAG>
+  static HURCHALLA_FORCE_INLINE
+  void incomplete(T* HURCHALLA_RESTRICT minuend,
+                  T* HURCHALLA_RESTRICT subtrahend,
+                  const T* HURCHALLA_RESTRICT u_hi,
+                  const T* HURCHALLA_RESTRICT u_lo,
+                  const T* HURCHALLA_RESTRICT n,
+                  const T* HURCHALLA_RESTRICT inv_n,
+                  std::size_t count, PTAG)
+  {
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    std::size_t i = ArrayRedcKernel<T>::incomplete(minuend, subtrahend, u_hi,
+                                             u_lo, n, inv_n, count, PTAG());
+    for (; i < count; ++i) {
+        RedcIncomplete::call(minuend[i], subtrahend[i], u_hi[i], u_lo[i],
+                             n[i], inv_n[i], PTAG());
+    }
+  }
+};
+
+
+}} // end namespace
+
+#if defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
+#endif
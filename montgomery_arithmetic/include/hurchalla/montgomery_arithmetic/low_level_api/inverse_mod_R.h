@@ -10,10 +10,17 @@
 
 
 #include "hurchalla/montgomery_arithmetic/low_level_api/detail/impl_inverse_mod_R.h"
+#include "hurchalla/montgomery_arithmetic/low_level_api/detail/impl_array_inverse_mod_R.h"
 #include "hurchalla/util/traits/safely_promote_unsigned.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
 #include "hurchalla/util/compiler_macros.h"
 #include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstddef>
+
+#if defined(_MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable : 4127)
+#endif
 
 namespace hurchalla {
 
@@ -45,6 +52,47 @@ T inverse_mod_R(T a)
 }
 
 
+// Array version of inverse_mod_R: for every i in [0, count), sets
+// result[i] to the integer x satisfying  x*a[i] ≡ 1 (mod R).
+// This is useful when you need to set up montgomery arithmetic for a large
+// number of moduli.  The elements are computed independently of each other,
+// which allows the compiler to vectorize the computation for native integer
+// types, and allows the CPU to overlap the work of different elements for
+// larger types (e.g. __uint128_t).  For __uint128_t this measured about 1.3x
+// faster than calling inverse_mod_R(a[i]) in a loop.  For native integer types
+// it performed the same as such a loop (which compilers already vectorize),
+// though it keeps the inverses vectorizable when your own per-modulus loop
+// does other work too.
+// The arrays result and a must not overlap.
+template <typename T>
+void inverse_mod_R(T* HURCHALLA_RESTRICT result,
+                   const T* HURCHALLA_RESTRICT a, std::size_t count)
+{
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(ut_numeric_limits<T>::is_signed), "");
+    static_assert(ut_numeric_limits<T>::is_modulo, "");
+    if (HPBC_CLOCKWORK_PRECONDITION2_MACRO_IS_ACTIVE) {
+        for (std::size_t i=0; i<count; ++i)
+            HPBC_CLOCKWORK_PRECONDITION2(a[i] % 2 == 1);
+    }
+
+    detail::impl_array_inverse_mod_R::call<T, ut_numeric_limits<T>::digits>(
+                                                             result, a, count);
+
+    if (HPBC_CLOCKWORK_POSTCONDITION2_MACRO_IS_ACTIVE) {
+        using P = typename safely_promote_unsigned<T>::type;
+        for (std::size_t i=0; i<count; ++i) {
+            HPBC_CLOCKWORK_POSTCONDITION2(static_cast<T>(1) == static_cast<T>(
+                             static_cast<P>(result[i]) * static_cast<P>(a[i])));
+        }
+    }
+}
+
+
 } // end namespace
 
+#if defined(_MSC_VER)
+#  pragma warning(pop)
+#endif
+
 #endif
@@ -0,0 +1,66 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_MAKE_MONTGOMERY_FORMS_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_MAKE_MONTGOMERY_FORMS_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/impl_make_montgomery_forms.h"
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstddef>
+
+namespace hurchalla {
+
+
+// Constructs a MontgomeryForm of type MF for each of the count moduli in the
+// array moduli, and writes them in order to the output iterator out.  Returns
+// the output iterator one past the last form written.
+//
+// This gives the same results as constructing each MF individually (i.e.
+// *out++ = MF(moduli[i])).  The constructor of a MontgomeryForm must compute
+// R mod n, the inverse of n mod R, and R^2 mod n, each of which is a chain of
+// dependent operations for a single modulus.  make_montgomery_forms computes
+// these constants for many moduli together, which lets the CPU overlap (and
+// the compiler vectorize) the work for different moduli.  The gain is modest,
+// since on x86-64 the setup for native types is bound by the hardware divider:
+// we measured about 15% faster than individual construction when compiling
+// with -march=native, and roughly the same speed with baseline flags.
+//
+// MontgomeryForm has const members and so is not assignable; out should be an
+// iterator that constructs its elements, such as std::back_inserter(vec) for a
+// std::vector<MF> vec.  (You may wish to call vec.reserve() first.)
+//
+// Preconditions: every modulus must satisfy the same requirements as for the
+// MF constructor - it must be odd, greater than 1, and less than or equal to
+// MF::max_modulus().
+//
+// Example:
+//   using MF = hurchalla::MontgomeryForm<std::uint64_t>;
+//   std::vector<MF> forms;
+//   forms.reserve(moduli.size());
+//   hurchalla::make_montgomery_forms<MF>(moduli.data(), moduli.size(),
+//                                        std::back_inserter(forms));
+template <class MF, class OutputIt>
+OutputIt make_montgomery_forms(const typename MF::IntegerType* moduli,
+                               std::size_t count, OutputIt out)
+{
+    using T = typename MF::IntegerType;
+    static_assert(ut_numeric_limits<T>::is_integer, "");
+    for (std::size_t i = 0; i < count; ++i) {
+        HPBC_CLOCKWORK_API_PRECONDITION(moduli[i] % 2 == 1);
+        HPBC_CLOCKWORK_API_PRECONDITION(moduli[i] > 1);
+        HPBC_CLOCKWORK_API_PRECONDITION(moduli[i] <= MF::max_modulus());
+    }
+    return detail::impl_make_montgomery_forms<MF>::call(moduli, count, out);
+}
+
+
+} // end namespace
+
+#endif
@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_MONTGOMERY_ARITHMETIC_POLLARD_RHO_BRENT_H_INCLUDED
+#define HURCHALLA_MONTGOMERY_ARITHMETIC_POLLARD_RHO_BRENT_H_INCLUDED
+
+
+#include "hurchalla/montgomery_arithmetic/detail/impl_pollard_rho_brent.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "hurchalla/modular_arithmetic/detail/clockwork_programming_by_contract.h"
+#include <cstddef>
+
+namespace hurchalla {
+
+
+// Returns a nontrivial factor f (1 < f < modulus) of the modulus of mf, using
+// Brent's variant of Pollard-Rho factoring.  MF must be a MontgomeryForm type
+// (for example MontgomeryForm<T>, or one of the aliases in
+// montgomery_form_aliases.h).  gcd_functor is used exactly as described for
+// MontgomeryForm's member function gcd_with_modulus().
+//
+// The modulus must be composite; if it is prime, this function will never
+// return.  You can check this beforehand with is_prime_miller_rabin().  The
+// returned factor is not necessarily prime.  Pollard-Rho finds a factor p
+// in roughly sqrt(p) iterations, so it is best suited to finding factors that
+// are not too large; you should remove tiny factors with trial division first,
+// since that is faster for them.
+//
+// NUM_WALKS is the number of independent walks (each with a different
+// constant c) that are run in lockstep, so that the CPU can overlap their
+// multiplies; the factor is found by whichever walk succeeds first.  The best
+// value depends on your CPU and the type of MF.  If you call this function
+// without specifying NUM_WALKS, it uses 2 walks when the modulus type is no
+// wider than the CPU's native integer type, and otherwise 1 walk (since a
+// single walk of a wider type already has enough multiplies to keep the CPU
+// busy).
+template <std::size_t NUM_WALKS, class MF, class F>
+typename MF::IntegerType pollard_rho_brent(const MF& mf, const F& gcd_functor)
+{
+    using T = typename MF::IntegerType;
+    HPBC_CLOCKWORK_API_PRECONDITION(mf.getModulus() > 3);
+    T factor = detail::impl_pollard_rho_brent<NUM_WALKS>::call(mf, gcd_functor);
+    HPBC_CLOCKWORK_POSTCONDITION(1 < factor && factor < mf.getModulus());
+    HPBC_CLOCKWORK_POSTCONDITION(mf.getModulus() % factor == 0);
+    return factor;
+}
+
+template <class MF, class F>
+typename MF::IntegerType pollard_rho_brent(const MF& mf, const F& gcd_functor)
+{
+    using T = typename MF::IntegerType;
+    constexpr std::size_t NUM_WALKS =
+        (ut_numeric_limits<T>::digits > HURCHALLA_TARGET_BIT_WIDTH) ? 1 : 2;
+    return pollard_rho_brent<NUM_WALKS>(mf, gcd_functor);
+}
+
+
+} // end namespace
+
+#endif
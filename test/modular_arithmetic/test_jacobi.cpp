@@ -0,0 +1,243 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+
+#include "hurchalla/modular_arithmetic/jacobi.h"
+#include "hurchalla/modular_arithmetic/modular_multiplication.h"
+#include "hurchalla/modular_arithmetic/modular_pow.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+namespace testjac {
+    // The textbook Jacobi symbol algorithm (using division), which we use as a
+    // reference for checking hc::jacobi().
+    template <typename T>
+    int jacobi(T a, T n)
+    {
+        static_assert(hc::ut_numeric_limits<T>::is_integer, "");
+        HPBC_CLOCKWORK_PRECONDITION(n % 2 == 1);
+        a = static_cast<T>(a % n);
+        int result = 1;
+        while (a != 0) {
+            while (a % 2 == 0) {
+                a = static_cast<T>(a / 2);
+                T r = static_cast<T>(n % 8);
+                if (r == 3 || r == 5)
+                    result = -result;
+            }
+            T tmp = a;
+            a = n;
+            n = tmp;
+            if (a % 4 == 3 && n % 4 == 3)
+                result = -result;
+            a = static_cast<T>(a % n);
+        }
+        return (n == 1) ? result : 0;
+    }
+}  // end namespace testjac
+
+
+void exhaustive_test_uint8_t();
+void exhaustive_test_uint8_t()
+{
+    using T = std::uint8_t;
+    for (unsigned int n = 1; n < 256; n += 2) {
+        for (unsigned int a = 0; a < 256; ++a) {
+            T ta = static_cast<T>(a);
+            T tn = static_cast<T>(n);
+            EXPECT_TRUE(hc::jacobi(ta, tn) == testjac::jacobi(ta, tn));
+        }
+    }
+}
+
+
+template <typename T>
+void test_modulus(T n)
+{
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(0), n) == ((n == 1) ? 1 : 0));
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(1), n) == 1);
+    EXPECT_TRUE(hc::jacobi(n, n) == ((n == 1) ? 1 : 0));
+
+    T a = static_cast<T>(n - 1);
+    EXPECT_TRUE(hc::jacobi(a, n) == testjac::jacobi(a, n));
+    a = static_cast<T>(n / 2);
+    EXPECT_TRUE(hc::jacobi(a, n) == testjac::jacobi(a, n));
+    a = static_cast<T>(n + 2);
+    EXPECT_TRUE(hc::jacobi(a, n) == testjac::jacobi(a, n));
+    a = hc::ut_numeric_limits<T>::max();
+    EXPECT_TRUE(hc::jacobi(a, n) == testjac::jacobi(a, n));
+    a = static_cast<T>(hc::ut_numeric_limits<T>::max() - 1);
+    EXPECT_TRUE(hc::jacobi(a, n) == testjac::jacobi(a, n));
+}
+
+
+template <typename T>
+T random_value(std::mt19937_64& gen)
+{
+    T x = static_cast<T>(gen());
+    // shifting by a variable avoids warnings for types of 32 bits or less,
+    // which never execute the loop body.
+    int shift = 32;
+    for (int k = 64; k < hc::ut_numeric_limits<T>::digits; k += 64) {
+        x = static_cast<T>(static_cast<T>(x << shift) << shift);
+        x = static_cast<T>(x | static_cast<T>(gen()));
+    }
+    return x;
+}
+
+template <typename T>
+void test_random(std::mt19937_64& gen)
+{
+    constexpr unsigned int digits = hc::ut_numeric_limits<T>::digits;
+    for (int i = 0; i < 1000; ++i) {
+        // vary the bit lengths of n and a
+        T n = static_cast<T>(random_value<T>(gen) >> (gen() % digits));
+        T a = static_cast<T>(random_value<T>(gen) >> (gen() % digits));
+        n = static_cast<T>(n | 1u);
+        EXPECT_TRUE(hc::jacobi(a, n) == testjac::jacobi(a, n));
+    }
+}
+
+
+// For a prime p, Euler's criterion says (a/p) == a^((p-1)/2) (mod p).
+template <typename T>
+void test_euler_criterion(T p, std::mt19937_64& gen)
+{
+    T e = static_cast<T>((p - 1) / 2);
+    for (int i = 0; i < 200; ++i) {
+        T a = static_cast<T>(random_value<T>(gen) % p);
+        T r = hc::modular_pow(a, e, p);
+        int expected = (r == 0) ? 0 : ((r == 1) ? 1 : -1);
+        if (expected == -1) {
+            EXPECT_TRUE(r == p - 1);
+        }
+        EXPECT_TRUE(hc::jacobi(a, p) == expected);
+    }
+}
+
+
+// The Jacobi symbol is completely multiplicative in its top argument:
+// (a*b/n) == (a/n)*(b/n)
+template <typename T>
+void test_multiplicative(T n, std::mt19937_64& gen)
+{
+    for (int i = 0; i < 200; ++i) {
+        T a = static_cast<T>(random_value<T>(gen) % n);
+        T b = static_cast<T>(random_value<T>(gen) % n);
+        T ab = hc::modular_multiplication_prereduced_inputs(a, b, n);
+        EXPECT_TRUE(hc::jacobi(ab, n) == hc::jacobi(a, n) * hc::jacobi(b, n));
+    }
+}
+
+
+template <typename T>
+void test_batch(T n, std::mt19937_64& gen)
+{
+    constexpr std::size_t count = 37;
+    std::vector<T> a(count);
+    std::vector<int> result(count);
+    for (std::size_t i = 0; i < count; ++i)
+        a[i] = random_value<T>(gen);
+    a[0] = 0;
+    a[1] = n;
+    hc::jacobi(result.data(), a.data(), count, n);
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_TRUE(result[i] == hc::jacobi(a[i], n));
+    }
+    // a count of zero should do nothing
+    result[0] = 5;
+    hc::jacobi(result.data(), a.data(), 0, n);
+    EXPECT_TRUE(result[0] == 5);
+}
+
+
+template <typename T>
+void test_jacobi()
+{
+    // a few basic examples first
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(1), static_cast<T>(1)) == 1);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(0), static_cast<T>(1)) == 1);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(2), static_cast<T>(7)) == 1);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(3), static_cast<T>(7)) == -1);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(5), static_cast<T>(21)) == 1);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(8), static_cast<T>(21)) == -1);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(19), static_cast<T>(45)) == 1);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(12), static_cast<T>(21)) == 0);
+    EXPECT_TRUE(hc::jacobi(static_cast<T>(30), static_cast<T>(7)) == 1);
+    if (hc::ut_numeric_limits<T>::digits >= 16) {
+        EXPECT_TRUE(hc::jacobi(static_cast<T>(1001), static_cast<T>(9907))
+                    == -1);
+    }
+
+    // --------- Test using moduli that are likely edge cases --------
+    T n = 1;
+    test_modulus(n);
+    n = 3;
+    test_modulus(n);
+    n = hc::ut_numeric_limits<T>::max();
+    test_modulus(n);
+    n = static_cast<T>(n - 2);
+    test_modulus(n);
+    n = static_cast<T>(hc::ut_numeric_limits<T>::max() / 2);
+    test_modulus(n);
+    n = static_cast<T>(n + 2);
+    test_modulus(n);
+
+    std::mt19937_64 gen(static_cast<std::uint64_t>(7));
+    test_random<T>(gen);
+    test_multiplicative(static_cast<T>(hc::ut_numeric_limits<T>::max() - 2),
+                        gen);
+    test_batch(static_cast<T>(hc::ut_numeric_limits<T>::max()), gen);
+    test_batch(static_cast<T>(45), gen);
+}
+
+
+
+TEST(ModularArithmetic, jacobi) {
+
+    exhaustive_test_uint8_t();
+
+    test_jacobi<std::uint8_t>();
+    test_jacobi<std::uint16_t>();
+    test_jacobi<std::uint32_t>();
+    test_jacobi<std::uint64_t>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_jacobi<__uint128_t>();
+#endif
+
+    // primes for Euler's criterion
+    std::mt19937_64 gen(static_cast<std::uint64_t>(11));
+    test_euler_criterion(static_cast<std::uint8_t>(251), gen);
+    test_euler_criterion(static_cast<std::uint16_t>(65521), gen);
+    test_euler_criterion(static_cast<std::uint32_t>(4294967291u), gen);
+    test_euler_criterion(static_cast<std::uint64_t>(18446744073709551557u),
+                         gen);
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    // 2^127 - 1 is prime
+    __uint128_t p = (static_cast<__uint128_t>(1) << 127) - 1;
+    test_euler_criterion(p, gen);
+#endif
+}
+
+
+} // end unnamed namespace
@@ -25,11 +25,13 @@
 
 
 #include "hurchalla/modular_arithmetic/modular_multiplicative_inverse.h"
+#include "hurchalla/modular_arithmetic/detail/impl_modular_multiplicative_inverse.h"
 #include "hurchalla/modular_arithmetic/modular_multiplication.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
 #include "hurchalla/util/compiler_macros.h"
 #include "gtest/gtest.h"
 #include <cstdint>
+#include <random>
 
 // do exhaustive test of all uint8_t?
 
@@ -313,4 +315,81 @@ TEST(ModularArithmetic, modular_multiplicative_inverse) {
 }
 
 
+
+// Tests the binary algorithm (which requires an odd modulus) directly, since
+// modular_multiplicative_inverse() uses it only for some types and platforms.
+void exhaustive_test_binary_uint8_t();
+void exhaustive_test_binary_uint8_t()
+{
+    using impl = hc::detail::impl_modular_multiplicative_inverse;
+    for (unsigned int m = 3; m < 256; m += 2) {
+        for (unsigned int i = 0; i < 256; ++i) {
+            std::uint8_t modulus = static_cast<std::uint8_t>(m);
+            std::uint8_t a = static_cast<std::uint8_t>(i);
+            std::uint8_t g;
+            std::uint8_t inv = impl::call_binary(a, modulus, g);
+            EXPECT_TRUE(g == testmmi::gcd(a, modulus));
+            if (g > 1)
+                EXPECT_TRUE(inv == 0);
+            else {
+                EXPECT_TRUE(inv > 0 && inv < modulus);
+                EXPECT_TRUE(static_cast<std::uint8_t>(1) ==
+                    hc::modular_multiplication_prereduced_inputs(
+                        static_cast<std::uint8_t>(a % modulus), inv, modulus));
+            }
+        }
+    }
+}
+
+template <typename T>
+void test_binary_matches_euclidean(T modulus, T a)
+{
+    using impl = hc::detail::impl_modular_multiplicative_inverse;
+    T g1, g2;
+    T inv1 = impl::call_binary(a, modulus, g1);
+    T inv2 = impl::call_euclidean(a, modulus, g2);
+    EXPECT_TRUE(inv1 == inv2);
+    EXPECT_TRUE(g1 == g2);
+    EXPECT_TRUE(g1 == testmmi::gcd(a, modulus));
+}
+
+template <typename T>
+void test_binary_inverse()
+{
+    T tmax = hc::ut_numeric_limits<T>::max();
+    T moduli[] = { 3, 15, 21, 255, static_cast<T>(tmax / 2),
+                   static_cast<T>(tmax - 2), tmax };
+    std::mt19937_64 gen(7);
+    for (T modulus : moduli) {
+        T values[] = { 0, 1, 2, 3, 12, static_cast<T>(modulus - 1),
+                       static_cast<T>(modulus - 2), modulus,
+                       static_cast<T>(tmax - 1), tmax };
+        for (T a : values)
+            test_binary_matches_euclidean(modulus, a);
+        for (int i=0; i<100; ++i) {
+            T a = 0;
+            for (int j=0; j < hc::ut_numeric_limits<T>::digits; j += 8)
+                a = static_cast<T>((a << 8) | static_cast<T>(gen() & 255u));
+            test_binary_matches_euclidean(modulus, a);
+            // values that share a factor with the modulus
+            test_binary_matches_euclidean(modulus,
+                  static_cast<T>(static_cast<T>(a % modulus) * 3 % modulus));
+        }
+    }
+}
+
+TEST(ModularArithmetic, modular_multiplicative_inverse_binary) {
+
+    exhaustive_test_binary_uint8_t();
+
+    test_binary_inverse<std::uint8_t>();
+    test_binary_inverse<std::uint16_t>();
+    test_binary_inverse<std::uint32_t>();
+    test_binary_inverse<std::uint64_t>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_binary_inverse<__uint128_t>();
+#endif
+}
+
+
 } // end unnamed namespace
@@ -30,6 +30,8 @@
 #include "hurchalla/util/compiler_macros.h"
 #include "gtest/gtest.h"
 #include <cstdint>
+#include <cstddef>
+#include <array>
 
 namespace {
 
@@ -187,4 +189,52 @@ TEST(ModularArithmetic, modular_pow_large_exponents) {
 }
 
 
+template <typename T>
+void test_array_modular_pow()
+{
+    T tmax = hc::ut_numeric_limits<T>::max();
+    std::array<T, 5> bases = {{ 0, 1, 2, static_cast<T>(tmax - 1), tmax }};
+    T moduli_list[] = { 2, 13, 14, static_cast<T>(tmax / 2), tmax };
+    T exponents_list[] = { 0, 1, 2, 3, 53, static_cast<T>(tmax - 1), tmax };
+    for (T modulus : moduli_list) {
+        for (T exponent : exponents_list) {
+            std::array<T, 5> result = hc::modular_pow(bases, exponent, modulus);
+            for (std::size_t i=0; i<bases.size(); ++i) {
+                EXPECT_TRUE(result[i] ==
+                            hc::modular_pow(bases[i], exponent, modulus));
+            }
+        }
+    }
+    std::array<T, 1> one_base = {{ 7 }};
+    EXPECT_TRUE(hc::modular_pow(one_base, static_cast<T>(6),
+                                static_cast<T>(13))[0] == 12);
+
+    // different exponents and moduli for each base, with exponents of
+    // varying bit lengths
+    std::array<T, 4> exponents = {{ 0, 53, tmax, 2 }};
+    std::array<T, 4> moduli = {{ 13, 2, static_cast<T>(tmax - 1), tmax }};
+    std::array<T, 4> bases4 = {{ 5, 17, static_cast<T>(tmax / 3), tmax }};
+    std::array<T, 4> result4 = hc::modular_pow(bases4, exponents, moduli);
+    for (std::size_t i=0; i<bases4.size(); ++i) {
+        EXPECT_TRUE(result4[i] ==
+                    hc::modular_pow(bases4[i], exponents[i], moduli[i]));
+    }
+    std::array<T, 3> exponents3 = {{ 12, 6, 6 }};
+    std::array<T, 3> moduli3 = {{ 13, 13, 14 }};
+    std::array<T, 3> bases3 = {{ 5, 7, 7 }};
+    std::array<T, 3> result3 = hc::modular_pow(bases3, exponents3, moduli3);
+    EXPECT_TRUE(result3[0] == 1 && result3[1] == 12 && result3[2] == 7);
+}
+
+TEST(ModularArithmetic, array_modular_pow) {
+    test_array_modular_pow<std::uint8_t>();
+    test_array_modular_pow<std::uint16_t>();
+    test_array_modular_pow<std::uint32_t>();
+    test_array_modular_pow<std::uint64_t>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_array_modular_pow<__uint128_t>();
+#endif
+}
+
+
 } // end unnamed namespace
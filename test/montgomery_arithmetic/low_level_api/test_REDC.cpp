@@ -18,6 +18,7 @@ TEST(MontgomeryArithmetic, REDC8) {
     std::vector<uint8_t> moduli { 3, 255, 19, 21, 211, 23, 171 };
     for (auto n : moduli)
         REDC_test_all(n);
+    REDC_array_test_all(moduli);
 }
 TEST(MontgomeryArithmetic, REDC16) {
     std::vector<uint16_t> moduli { 3, 17, UINT16_C(65535),
@@ -25,6 +26,7 @@ TEST(MontgomeryArithmetic, REDC16) {
                           UINT16_C(11111) };
     for (auto n : moduli)
         REDC_test_all(n);
+    REDC_array_test_all(moduli);
 }
 TEST(MontgomeryArithmetic, REDC32) {
     std::vector<uint32_t> moduli { 3, 13, UINT32_C(4294967295),
@@ -32,6 +34,7 @@ TEST(MontgomeryArithmetic, REDC32) {
                           UINT32_C(246098243), UINT32_C(1111111) };
     for (auto n : moduli)
         REDC_test_all(n);
+    REDC_array_test_all(moduli);
 }
 TEST(MontgomeryArithmetic, REDC64) {
     std::vector<uint64_t> moduli { 3, 11, UINT64_C(18446744073709551615),
@@ -40,6 +43,7 @@ TEST(MontgomeryArithmetic, REDC64) {
                           UINT64_C(3194806714689), UINT64_C(11111111311) };
     for (auto n : moduli)
         REDC_test_all(n);
+    REDC_array_test_all(moduli);
 }
 
 #if !defined(__GNUC__) || __GNUC__ >= 11 || defined(__INTEL_COMPILER) || \
@@ -67,6 +71,7 @@ TEST(MontgomeryArithmetic, REDC128) {
                                               UINT64_C(895835939) };
     for (auto n : moduli)
         REDC_test_all(n);
+    REDC_array_test_all(moduli);
 }
 # endif
 #endif
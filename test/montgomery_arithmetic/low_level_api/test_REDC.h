@@ -19,6 +19,8 @@
 #include "gtest/gtest.h"
 #include <cstdint>
 #include <type_traits>
+#include <vector>
+#include <cstddef>
 
 #if defined(_MSC_VER)
 #  pragma warning(push)
@@ -278,6 +280,70 @@ void REDC_test_all(T n)
 }
 
 
+// verify that the array versions of REDC give the same results as the
+// single value versions
+template <typename T, class PTAG>
+void REDC_array_test(const std::vector<T>& moduli, std::size_t count)
+{
+    static_assert(hc::ut_numeric_limits<T>::is_integer, "");
+    static_assert(!(hc::ut_numeric_limits<T>::is_signed), "");
+    HPBC_CLOCKWORK_PRECONDITION2(moduli.size() > 0);
+
+    std::vector<T> u_hi(count), u_lo(count), n(count), inv_n(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        n[i] = moduli[i % moduli.size()];
+        inv_n[i] = hc::inverse_mod_R(n[i]);
+        // an arbitrary mix of values, including the extremes
+        T x = static_cast<T>(static_cast<T>(i) * static_cast<T>(157) + 3);
+        if (i % 5 == 0) {
+            u_hi[i] = static_cast<T>(n[i] - 1);
+            u_lo[i] = static_cast<T>(static_cast<T>(0) - 1);
+        } else if (i % 5 == 1) {
+            u_hi[i] = 0;
+            u_lo[i] = 0;
+        } else {
+            u_hi[i] = static_cast<T>(x % n[i]);
+            u_lo[i] = static_cast<T>(x ^ n[i]);
+        }
+    }
+
+    std::vector<T> result(count), minuend(count), subtrahend(count);
+    hc::REDC_standard(result.data(), u_hi.data(), u_lo.data(), n.data(),
+                      inv_n.data(), count, PTAG());
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_TRUE(result[i] ==
+             hc::REDC_standard(u_hi[i], u_lo[i], n[i], inv_n[i], PTAG()));
+    }
+
+    hc::REDC_incomplete(minuend.data(), subtrahend.data(), u_hi.data(),
+                        u_lo.data(), n.data(), inv_n.data(), count, PTAG());
+    for (std::size_t i = 0; i < count; ++i) {
+        T mnd, sub;
+        hc::REDC_incomplete(mnd, sub, u_hi[i], u_lo[i], n[i], inv_n[i], PTAG());
+        EXPECT_TRUE(minuend[i] == mnd && subtrahend[i] == sub);
+    }
+
+    hc::REDC_incomplete(result.data(), u_hi.data(), u_lo.data(), n.data(),
+                        inv_n.data(), count, PTAG());
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_TRUE(result[i] ==
+             hc::REDC_incomplete(u_hi[i], u_lo[i], n[i], inv_n[i], PTAG()));
+    }
+}
+
+template <typename T>
+void REDC_array_test_all(const std::vector<T>& moduli)
+{
+    // use counts that cover empty arrays, and both full and partial blocks
+    // for any SIMD kernel
+    std::size_t counts[] = { 0, 1, 7, 8, 9, 16, 37 };
+    for (std::size_t count : counts) {
+        REDC_array_test<T, hc::LowlatencyTag>(moduli, count);
+        REDC_array_test<T, hc::LowuopsTag>(moduli, count);
+    }
+}
+
+
 
 } // end unnamed namespace
 
@@ -11,6 +11,8 @@
 #include "hurchalla/util/traits/ut_numeric_limits.h"
 #include "gtest/gtest.h"
 #include <cstdint>
+#include <cstddef>
+#include <vector>
 
 namespace {
 
@@ -100,6 +102,46 @@ void test_inverse_mod_r()
 
 
 
+template <typename T>
+void test_array_inverse(std::size_t count)
+{
+    using P = typename hc::safely_promote_unsigned<T>::type;
+    T tmax = hc::ut_numeric_limits<T>::max();
+    T evenmax = static_cast<T>((tmax/2)*2);
+    T oddmax = (evenmax != tmax) ? tmax : static_cast<T>(tmax - 1);
+
+    std::vector<T> a(count);
+    std::vector<T> result(count);
+    // use a mix of small, large, and scattered odd values
+    T scatter = static_cast<T>(oddmax / 7);
+    for (std::size_t i=0; i<count; ++i) {
+        if (i % 3 == 0)
+            a[i] = static_cast<T>(2*i + 1);
+        else if (i % 3 == 1)
+            a[i] = static_cast<T>(oddmax - 2*i);
+        else
+            a[i] = static_cast<T>(static_cast<P>(scatter) * static_cast<P>(i)
+                                  | 1u);
+    }
+    hc::inverse_mod_R(result.data(), a.data(), count);
+    for (std::size_t i=0; i<count; ++i) {
+        EXPECT_TRUE(result[i] == hc::inverse_mod_R(a[i]));
+        EXPECT_TRUE(static_cast<T>(static_cast<P>(result[i]) *
+                                   static_cast<P>(a[i])) == 1);
+    }
+}
+
+template <typename T>
+void test_array_inverse_all()
+{
+    // the counts cover empty arrays, partial and full vector widths, and
+    // (for types larger than the native width) partial and multiple blocks
+    std::size_t counts[] = { 0, 1, 3, 8, 17, 64, 65, 200 };
+    for (std::size_t count : counts)
+        test_array_inverse<T>(count);
+}
+
+
 TEST(MontgomeryArithmetic, inverse_mod_r) {
     test_inverse_mod_r<std::uint8_t>();
     test_inverse_mod_r<std::uint16_t>();
@@ -109,6 +151,14 @@ TEST(MontgomeryArithmetic, inverse_mod_r) {
     test_inverse_mod_r<__uint128_t>();
 #endif
 
+    test_array_inverse_all<std::uint8_t>();
+    test_array_inverse_all<std::uint16_t>();
+    test_array_inverse_all<std::uint32_t>();
+    test_array_inverse_all<std::uint64_t>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_array_inverse_all<__uint128_t>();
+#endif
+
     test_inverse_exhaustive<std::uint8_t>();
     test_inverse_exhaustive<std::uint16_t>();
 }
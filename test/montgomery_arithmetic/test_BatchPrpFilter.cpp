@@ -0,0 +1,172 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/BatchPrpFilter.h"
+#include "hurchalla/montgomery_arithmetic/is_prime_miller_rabin.h"
+#include "hurchalla/modular_arithmetic/modular_pow.h"
+#include "hurchalla/modular_arithmetic/modular_multiplication.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <random>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+// a simple reference implementation of the base 2 strong probable prime test
+template <typename T>
+bool is_base2_strong_prp(T n)
+{
+    if (n < 3 || n % 2 == 0)
+        return n == 2;
+    T d = static_cast<T>(n - 1);
+    int s = 0;
+    while (d % 2 == 0) {
+        d = static_cast<T>(d / 2);
+        ++s;
+    }
+    T x = hc::modular_pow<T>(2, d, n);
+    if (x == 1 || x == n - 1)
+        return true;
+    for (int r = 1; r < s; ++r) {
+        x = hc::modular_multiplication_prereduced_inputs(x, x, n);
+        if (x == n - 1)
+            return true;
+    }
+    return false;
+}
+
+
+template <typename T, std::size_t LANES>
+void test_filter(const std::vector<T>& candidates)
+{
+    hc::BatchPrpFilter<T, LANES> filter;
+    std::vector<T> survivors;
+    filter.filter(candidates.begin(), candidates.end(),
+                  std::back_inserter(survivors));
+    EXPECT_TRUE(filter.pending() == 0);
+    EXPECT_TRUE(filter.candidates() == candidates.size());
+    EXPECT_TRUE(filter.survivors() == survivors.size());
+
+    std::vector<T> expected;
+    for (T x : candidates) {
+        if (is_base2_strong_prp(x))
+            expected.push_back(x);
+    }
+    std::sort(survivors.begin(), survivors.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_TRUE(survivors == expected);
+}
+
+
+// returns a shuffled stream of candidates, taken from several ranges of
+// different bit lengths (including the largest bit lengths, which use
+// MontgomeryHalf and MontgomeryFull)
+template <typename T>
+std::vector<T> make_candidates(std::mt19937_64& gen, std::size_t per_range)
+{
+    constexpr int digits = hc::ut_numeric_limits<T>::digits;
+    constexpr T maxT = hc::ut_numeric_limits<T>::max();
+    std::vector<T> candidates;
+    for (T x = 0; x < 200; ++x)
+        candidates.push_back(x);
+    const T starts[] = { static_cast<T>(maxT >> 1),
+                         static_cast<T>(maxT >> 2),
+                         static_cast<T>(maxT >> (digits/2)),
+                         static_cast<T>(maxT - 2 * per_range),
+                         static_cast<T>((maxT >> 1) - 2 * per_range),
+                         static_cast<T>((maxT >> 2) - 2 * per_range),
+                         static_cast<T>(maxT / 3) };
+    for (T start : starts) {
+        start = static_cast<T>(start | 1u);
+        for (std::size_t i = 0; i < per_range; ++i)
+            candidates.push_back(static_cast<T>(start + 2 * i));
+    }
+    std::shuffle(candidates.begin(), candidates.end(), gen);
+    return candidates;
+}
+
+
+TEST(MontgomeryArithmetic, BatchPrpFilter) {
+    std::mt19937_64 gen(7);
+    {
+        auto c = make_candidates<std::uint16_t>(gen, 300);
+        test_filter<std::uint16_t, 1>(c);
+        test_filter<std::uint16_t, 4>(c);
+    }
+    {
+        auto c = make_candidates<std::uint32_t>(gen, 300);
+        test_filter<std::uint32_t, 3>(c);
+        test_filter<std::uint32_t, 4>(c);
+        test_filter<std::uint32_t, 8>(c);
+    }
+    {
+        auto c = make_candidates<std::uint64_t>(gen, 300);
+        test_filter<std::uint64_t, 2>(c);
+        test_filter<std::uint64_t, 4>(c);
+    }
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    {
+        auto c = make_candidates<__uint128_t>(gen, 150);
+        test_filter<__uint128_t, 4>(c);
+    }
+#endif
+}
+
+TEST(MontgomeryArithmetic, BatchPrpFilter_streaming) {
+    using T = std::uint32_t;
+    hc::BatchPrpFilter<T, 4> filter;
+    std::vector<T> survivors;
+    auto out = std::back_inserter(survivors);
+    // base 2 strong pseudoprimes, which the filter can't distinguish from
+    // primes
+    const T spsp[] = { 42799, 49141, 2047, 52633, 65281 };
+    for (T x : spsp)
+        out = filter.push(x, out);
+    // the 4 candidates with bit length 16 complete a bucket; the 11 bit
+    // candidate 2047 is still pending
+    EXPECT_TRUE(survivors.size() == 4);
+    EXPECT_TRUE(filter.pending() == 1);
+    out = filter.flush(out);
+    EXPECT_TRUE(survivors.size() == 5);
+    EXPECT_TRUE(filter.pending() == 0);
+
+    // every prime must survive, and a composite that is not a base 2 strong
+    // pseudoprime must not survive.
+    survivors.clear();
+    T start = 4294967291u - 20000;  // 4294967291 is the largest 32 bit prime
+    std::size_t num_primes = 0;
+    for (T x = start; x <= 4294967291u; x += 2) {
+        out = filter.push(x, out);
+        if (hc::is_prime_miller_rabin(x))
+            ++num_primes;
+    }
+    out = filter.flush(out);
+    EXPECT_TRUE(survivors.size() == num_primes);
+    for (T x : survivors)
+        EXPECT_TRUE(hc::is_prime_miller_rabin(x));
+    EXPECT_TRUE(filter.candidates() == 5 + 10001);
+    EXPECT_TRUE(filter.survivors() == 5 + num_primes);
+}
+
+
+} // end unnamed namespace
@@ -0,0 +1,105 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/FixedBasePow.h"
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <random>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+template <class MF, int TABLE_BITS>
+void test_fixed_base(const MF& mf, typename MF::IntegerType base,
+                     std::mt19937_64& gen)
+{
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+    constexpr T maxT = hc::ut_numeric_limits<T>::max();
+
+    V mv_base = mf.convertIn(base);
+    hc::FixedBasePow<MF, TABLE_BITS> fbp(mf, mv_base);
+
+    // the exponents include zero, one, small values, and the largest T value
+    std::vector<T> exponents = { 0, 1, 2, 3, 15, 16, 17, maxT,
+                                 static_cast<T>(maxT - 1), static_cast<T>(maxT/2) };
+    for (int i=0; i<20; ++i)
+        exponents.push_back(static_cast<T>(static_cast<T>(gen()) & maxT));
+
+    for (T e : exponents) {
+        EXPECT_TRUE(mf.convertOut(fbp.pow(e)) == mf.convertOut(mf.pow(mv_base, e)));
+    }
+
+    // the batch version, with counts covering zero, partial chunks, and
+    // multiple chunks plus a remainder
+    std::vector<V> results(exponents.size());
+    for (std::size_t count : { std::size_t(0), std::size_t(1), std::size_t(3),
+                               std::size_t(4), std::size_t(9),
+                               exponents.size() }) {
+        fbp.pow(results.data(), exponents.data(), count);
+        for (std::size_t i=0; i<count; ++i) {
+            EXPECT_TRUE(mf.convertOut(results[i]) ==
+                        mf.convertOut(mf.pow(mv_base, exponents[i])));
+        }
+    }
+}
+
+
+template <class MF>
+void test_FixedBasePow()
+{
+    using T = typename MF::IntegerType;
+    std::mt19937_64 gen(13);
+    T maxmod = MF::max_modulus();
+
+    T moduli[] = { 3, 13, static_cast<T>(maxmod - 2), maxmod };
+    for (T modulus : moduli) {
+        MF mf(modulus);
+        T bases[] = { 0, 1, 2, static_cast<T>(modulus - 1),
+                      static_cast<T>(modulus / 2) };
+        for (T base : bases) {
+            test_fixed_base<MF, 1>(mf, base, gen);
+            test_fixed_base<MF, 4>(mf, base, gen);
+            test_fixed_base<MF, 5>(mf, base, gen);
+            test_fixed_base<MF, 8>(mf, base, gen);
+        }
+    }
+}
+
+
+TEST(MontgomeryArithmetic, FixedBasePow) {
+    test_FixedBasePow<hc::MontgomeryForm<std::uint8_t>>();
+    test_FixedBasePow<hc::MontgomeryForm<std::uint16_t>>();
+    test_FixedBasePow<hc::MontgomeryForm<std::uint32_t>>();
+    test_FixedBasePow<hc::MontgomeryForm<std::uint64_t>>();
+    test_FixedBasePow<hc::MontgomeryForm<std::int64_t>>();
+    test_FixedBasePow<hc::MontgomeryQuarter<std::uint64_t>>();
+    test_FixedBasePow<hc::MontgomeryHalf<std::uint32_t>>();
+    test_FixedBasePow<hc::MontgomeryStandardMathWrapper<std::uint64_t>>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_FixedBasePow<hc::MontgomeryForm<__uint128_t>>();
+#endif
+}
+
+
+} // end unnamed namespace
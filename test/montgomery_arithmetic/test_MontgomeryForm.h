@@ -30,6 +30,7 @@
 #include "hurchalla/modular_arithmetic/modular_addition.h"
 #include "hurchalla/modular_arithmetic/modular_subtraction.h"
 #include "hurchalla/modular_arithmetic/modular_pow.h"
+#include "hurchalla/modular_arithmetic/jacobi.h"
 #include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
 #include "hurchalla/util/traits/extensible_make_unsigned.h"
 #include "hurchalla/util/traits/ut_numeric_limits.h"
@@ -40,6 +41,7 @@
 #include <type_traits>
 #include <array>
 #include <memory>
+#include <vector>
 
 
 // We define the following macro in order to be able to specify a variadic
@@ -325,6 +327,36 @@ void test_inverse(const M& mf)
     test_single_inverse(mf, static_cast<T>(modulus-2));
     test_single_inverse(mf, static_cast<T>(modulus/2));
     test_single_inverse(mf, static_cast<T>((modulus/2) - 1));
+
+    // test the batch version of inverse(), including zero elements
+    using V = typename M::MontgomeryValue;
+    using C = typename M::CanonicalValue;
+    std::vector<T> vals = { 0, 1, 2, max, static_cast<T>(max-1), mid, 0,
+                            static_cast<T>(modulus-1), static_cast<T>(modulus-2),
+                            static_cast<T>(modulus/2), 0 };
+    std::vector<V> mvals;
+    std::size_t expected_noninvertible = 0;
+    for (T a : vals) {
+        mvals.push_back(mf.convertIn(a));
+        if (mf.inverse(mvals.back()) == mf.getZeroValue())
+            ++expected_noninvertible;
+    }
+    for (std::size_t count : { std::size_t(0), std::size_t(1), std::size_t(2),
+                               vals.size() }) {
+        std::vector<C> inverses(count);
+        std::size_t num = mf.inverse(inverses.data(), mvals.data(), count);
+        std::size_t expected_num = 0;
+        for (std::size_t i=0; i<count; ++i) {
+            C expected = mf.inverse(mvals[i]);
+            EXPECT_TRUE(inverses[i] == expected);
+            if (expected == mf.getZeroValue())
+                ++expected_num;
+        }
+        EXPECT_TRUE(num == expected_num);
+    }
+    std::vector<C> all_inverses(vals.size());
+    EXPECT_TRUE(mf.inverse(all_inverses.data(), mvals.data(), vals.size())
+                == expected_noninvertible);
 }
 
 template <typename M>
@@ -459,6 +491,24 @@ void test_mf_general_checks(const M& mf, typename M::IntegerType a,
         auto correct_val = tma::modpow<T>(t_bases[i], exponent, modulus);
         EXPECT_TRUE(mf.convertOut(mv_res[i]) == correct_val);
     }
+
+    // test the array versions of convertIn() and convertOut()
+    std::array<V,3> mv_converted;
+    std::array<T,3> t_converted;
+    mf.convertIn(mv_converted.data(), t_bases.data(), t_bases.size());
+    mf.convertOut(t_converted.data(), mv_converted.data(), t_bases.size());
+    for (std::size_t i = 0; i < t_bases.size(); ++i) {
+        EXPECT_TRUE(mf.getCanonicalValue(mv_converted[i]) ==
+                    mf.getCanonicalValue(mf.convertIn(t_bases[i])));
+        EXPECT_TRUE(t_converted[i] == mf.convertOut(mv_converted[i]));
+        EXPECT_TRUE(t_converted[i] == mf.convertOut(mf.convertIn(t_bases[i])));
+    }
+    mf.template convertIn<hc::LowlatencyTag>(mv_converted.data(),
+                                             t_bases.data(), t_bases.size());
+    mf.template convertOut<hc::LowlatencyTag>(t_converted.data(),
+                                        mv_converted.data(), t_bases.size());
+    for (std::size_t i = 0; i < t_bases.size(); ++i)
+        EXPECT_TRUE(t_converted[i] == mf.convertOut(mf.convertIn(t_bases[i])));
 }
 
 
@@ -800,6 +850,84 @@ void test_MontgomeryForm()
         EXPECT_TRUE(mf.gcd_with_modulus(mf.convertIn(12), GcdFunctor()) == 3);
     }
 
+    // test batch gcd
+    {
+        M mf = MFactory::construct(static_cast<T>(35));
+        std::vector<V> vals;
+        for (int i = 0; i < 200; ++i)
+            vals.push_back(mf.convertIn(static_cast<T>((i % 2 == 0) ? 1 : 9)));
+        std::size_t index = 0;
+        EXPECT_TRUE(mf.gcd_with_modulus(vals.data(), 0, GcdFunctor(), index) == 1);
+        EXPECT_TRUE(index == 0);
+        EXPECT_TRUE(mf.gcd_with_modulus(vals.data(), vals.size(), GcdFunctor(),
+                                        index) == 1);
+        EXPECT_TRUE(index == vals.size());
+        // a nontrivial gcd in a later block
+        vals[150] = mf.convertIn(static_cast<T>(14));
+        vals[170] = mf.convertIn(static_cast<T>(5));
+        EXPECT_TRUE(mf.gcd_with_modulus(vals.data(), vals.size(), GcdFunctor(),
+                                        index) == 7);
+        EXPECT_TRUE(index == 150);
+        EXPECT_TRUE(mf.gcd_with_modulus(vals.data(), 150, GcdFunctor(),
+                                        index) == 1);
+        EXPECT_TRUE(index == 150);
+        // a product that becomes zero within a block: 14*5 == 0 (mod 35)
+        vals[149] = mf.convertIn(static_cast<T>(5));
+        EXPECT_TRUE(mf.gcd_with_modulus(vals.data(), vals.size(), GcdFunctor(),
+                                        index) == 5);
+        EXPECT_TRUE(index == 149);
+        // a zero value in the first position
+        vals[0] = mf.getZeroValue();
+        EXPECT_TRUE(mf.gcd_with_modulus(vals.data(), vals.size(), GcdFunctor(),
+                                        index) == 35);
+        EXPECT_TRUE(index == 0);
+        EXPECT_TRUE(mf.gcd_with_modulus(vals.data() + 1, 1, GcdFunctor(),
+                                        index) == 1);
+        EXPECT_TRUE(index == 1);
+    }
+
+    // test jacobi
+    {
+        M mf = MFactory::construct(static_cast<T>(45));
+        EXPECT_TRUE(mf.jacobi(mf.convertIn(19)) == 1);
+        EXPECT_TRUE(mf.jacobi(mf.convertIn(2)) == -1);
+        EXPECT_TRUE(mf.jacobi(mf.convertIn(30)) == 0);
+        EXPECT_TRUE(mf.jacobi(mf.getZeroValue()) == 0);
+        EXPECT_TRUE(mf.jacobi(mf.getUnityValue()) == 1);
+    }
+    {
+        T max = max_modulus;
+        T mid = static_cast<T>(max/2);
+        mid = (mid % 2 == 0) ? static_cast<T>(mid + 1) : mid;
+        std::vector<T> moduli = { 3, max, mid };
+        if (113 <= max)
+            moduli.push_back(113);   // prime
+        for (T modulus : moduli) {
+            M mf = MFactory::construct(modulus);
+            std::vector<V> vals;
+            V x = mf.convertIn(static_cast<T>(modulus - 1));
+            V y = mf.convertIn(static_cast<T>(modulus / 3));
+            for (int i = 0; i < 40; ++i) {
+                vals.push_back(x);
+                // subtract() and unorderedSubtract() can produce values that
+                // are not canonical, which jacobi() must handle.
+                vals.push_back(mf.subtract(x, y));
+                vals.push_back(mf.unorderedSubtract(y, x));
+                x = mf.add(mf.multiply(x, y), mf.getUnityValue());
+                y = mf.add(y, x);
+            }
+            std::vector<int> results(vals.size());
+            mf.jacobi(results.data(), vals.data(), vals.size());
+            for (std::size_t i = 0; i < vals.size(); ++i) {
+                using U = typename hc::extensible_make_unsigned<T>::type;
+                int expected = hc::jacobi(static_cast<U>(mf.convertOut(vals[i])),
+                                          static_cast<U>(modulus));
+                EXPECT_TRUE(mf.jacobi(vals[i]) == expected);
+                EXPECT_TRUE(results[i] == expected);
+            }
+        }
+    }
+
     // test remainder() and inverse()
     {
         T max = max_modulus;
@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/MontgomeryFormArray.h"
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <random>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+// compares every lane against a separate MontgomeryForm for that lane's modulus
+template <typename T, std::size_t N>
+void test_lanes(const std::array<T, N>& moduli, std::mt19937_64& gen)
+{
+    using MFA = hc::MontgomeryFormArray<T, N>;
+    using MF = hc::MontgomeryForm<T>;
+    using LaneArray = typename MFA::LaneArray;
+    MFA mfa(moduli);
+    EXPECT_TRUE(mfa.getModuli() == moduli);
+
+    constexpr T maxT = hc::ut_numeric_limits<T>::max();
+    LaneArray a, b, c, exponents;
+    for (std::size_t i=0; i<N; ++i) {
+        a[i] = static_cast<T>(static_cast<T>(gen()) & maxT);
+        b[i] = static_cast<T>(a[i] % moduli[i]);
+        c[i] = static_cast<T>(moduli[i] - 1);
+        // include small and large exponents, so that lanes differ in length
+        if (i % 3 == 0)
+            exponents[i] = static_cast<T>(i);
+        else
+            exponents[i] = static_cast<T>(static_cast<T>(gen()) & maxT);
+    }
+    auto x = mfa.convertIn(a);
+    auto y = mfa.convertIn(b);
+    auto z = mfa.convertIn(c);
+
+    LaneArray r_in = mfa.convertOut(x);
+    LaneArray r_one = mfa.convertOut(mfa.getUnityValue());
+    LaneArray r_zero = mfa.convertOut(mfa.getZeroValue());
+    LaneArray r_add = mfa.convertOut(mfa.add(x, y));
+    LaneArray r_sub = mfa.convertOut(mfa.subtract(x, y));
+    LaneArray r_mul = mfa.convertOut(mfa.multiply(x, y));
+    LaneArray r_sq = mfa.convertOut(mfa.square(y));
+    LaneArray r_fma = mfa.convertOut(mfa.fmadd(x, y, z));
+    LaneArray r_pow = mfa.convertOut(mfa.pow(y, exponents));
+    LaneArray r_pow1 = mfa.convertOut(mfa.pow(y, static_cast<T>(37)));
+    LaneArray r_pow0 = mfa.convertOut(mfa.pow(y, static_cast<T>(0)));
+    LaneArray r_two = mfa.convertOut(mfa.two_pow(exponents));
+
+    for (std::size_t i=0; i<N; ++i) {
+        MF mf(moduli[i]);
+        auto mx = mf.convertIn(a[i]);
+        auto my = mf.convertIn(b[i]);
+        auto mz = mf.convertIn(c[i]);
+        EXPECT_TRUE(r_in[i] == mf.convertOut(mx));
+        EXPECT_TRUE(r_one[i] == 1);
+        EXPECT_TRUE(r_zero[i] == 0);
+        EXPECT_TRUE(r_add[i] == mf.convertOut(mf.add(mx, my)));
+        EXPECT_TRUE(r_sub[i] == mf.convertOut(mf.subtract(mx, my)));
+        EXPECT_TRUE(r_mul[i] == mf.convertOut(mf.multiply(mx, my)));
+        EXPECT_TRUE(r_sq[i] == mf.convertOut(mf.square(my)));
+        EXPECT_TRUE(r_fma[i] == mf.convertOut(
+                          mf.add(mf.multiply(mx, my), mf.getCanonicalValue(mz))));
+        EXPECT_TRUE(r_pow[i] == mf.convertOut(mf.pow(my, exponents[i])));
+        EXPECT_TRUE(r_pow1[i] == mf.convertOut(mf.pow(my, static_cast<T>(37))));
+        EXPECT_TRUE(r_pow0[i] == 1);
+        EXPECT_TRUE(r_two[i] == mf.convertOut(mf.two_pow(exponents[i])));
+    }
+
+    // all exponents zero
+    LaneArray zeros;
+    for (std::size_t i=0; i<N; ++i)
+        zeros[i] = 0;
+    LaneArray r_pz = mfa.convertOut(mfa.pow(y, zeros));
+    LaneArray r_tz = mfa.convertOut(mfa.two_pow(zeros));
+    for (std::size_t i=0; i<N; ++i) {
+        EXPECT_TRUE(r_pz[i] == 1);
+        EXPECT_TRUE(r_tz[i] == 1);
+    }
+}
+
+
+template <typename T, std::size_t N>
+void test_MontgomeryFormArray()
+{
+    using MFA = hc::MontgomeryFormArray<T, N>;
+    std::mt19937_64 gen(11);
+    T maxmod = MFA::max_modulus();
+
+    std::array<T, N> moduli;
+    for (std::size_t i=0; i<N; ++i) {
+        if (i % 4 == 0)
+            moduli[i] = static_cast<T>(2*i + 3);
+        else if (i % 4 == 1)
+            moduli[i] = static_cast<T>(maxmod - static_cast<T>(2*i));
+        else {
+            T val = static_cast<T>(static_cast<T>(gen()) & maxmod);
+            val = static_cast<T>(val | 1);
+            moduli[i] = (val < 3) ? static_cast<T>(3) : val;
+        }
+    }
+    test_lanes(moduli, gen);
+
+    for (std::size_t i=0; i<N; ++i)
+        moduli[i] = maxmod;
+    test_lanes(moduli, gen);
+}
+
+
+TEST(MontgomeryArithmetic, MontgomeryFormArray) {
+    test_MontgomeryFormArray<std::uint8_t, 5>();
+    test_MontgomeryFormArray<std::uint16_t, 4>();
+    test_MontgomeryFormArray<std::uint32_t, 1>();
+    test_MontgomeryFormArray<std::uint32_t, 16>();
+    test_MontgomeryFormArray<std::uint64_t, 8>();
+    test_MontgomeryFormArray<std::uint64_t, 13>();
+    test_MontgomeryFormArray<std::int64_t, 8>();
+    test_MontgomeryFormArray<std::int32_t, 3>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_MontgomeryFormArray<__uint128_t, 4>();
+#endif
+}
+
+
+} // end unnamed namespace
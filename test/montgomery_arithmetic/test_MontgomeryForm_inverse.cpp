@@ -0,0 +1,130 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// MontgomeryForm's inverse() computes the inverse directly in the montgomery
+// domain whenever modular_multiplicative_inverse() would prefer the binary
+// algorithm.  For uint32_t and uint64_t on a CPU with a divide instruction that
+// doesn't happen, so the test CMakeLists.txt also builds this file into a test
+// executable that defines HURCHALLA_TARGET_ISA_HAS_NO_DIVIDE.  We check the
+// results against multiplication and a division based gcd, rather than against
+// modular_multiplicative_inverse(), which would use the binary algorithm too.
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/montgomery_arithmetic/detail/MontyFullRange.h"
+#include "hurchalla/montgomery_arithmetic/detail/MontyHalfRange.h"
+#include "hurchalla/montgomery_arithmetic/detail/MontyQuarterRange.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <random>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+template <class T, class Monty> using MF =
+    hc::MontgomeryForm<T, false, Monty>;
+
+
+template <typename T>
+T reference_gcd(T a, T b)
+{
+    while (b != 0) {
+        T tmp = static_cast<T>(a % b);
+        a = b;
+        b = tmp;
+    }
+    return a;
+}
+
+
+template <class M>
+void test_single_inverse(const M& mf, typename M::IntegerType a)
+{
+    using T = typename M::IntegerType;
+    T n = mf.getModulus();
+    auto x = mf.convertIn(a);
+    auto inv = mf.inverse(x);
+    if (reference_gcd(static_cast<T>(a % n), n) != 1) {
+        EXPECT_TRUE(inv == mf.getZeroValue());
+    } else {
+        EXPECT_TRUE(mf.convertOut(inv) != 0);
+        EXPECT_TRUE(mf.convertOut(mf.multiply(x, inv)) == 1);
+    }
+}
+
+
+template <class M>
+void test_inverse_modulus(typename M::IntegerType n, std::mt19937_64& gen)
+{
+    using T = typename M::IntegerType;
+    M mf(n);
+    T max = hc::ut_numeric_limits<T>::max();
+    test_single_inverse(mf, static_cast<T>(0));
+    test_single_inverse(mf, static_cast<T>(1));
+    test_single_inverse(mf, static_cast<T>(2));
+    test_single_inverse(mf, static_cast<T>(3));
+    test_single_inverse(mf, static_cast<T>(n - 1));
+    test_single_inverse(mf, static_cast<T>(n - 2));
+    test_single_inverse(mf, static_cast<T>(n / 2));
+    test_single_inverse(mf, static_cast<T>(max));
+    test_single_inverse(mf, static_cast<T>(max - 1));
+    for (int i = 0; i < 200; ++i)
+        test_single_inverse(mf, static_cast<T>(gen()));
+}
+
+
+template <class M>
+void test_inverse()
+{
+    using T = typename M::IntegerType;
+    T maxmod = M::max_modulus();
+    std::mt19937_64 gen(static_cast<std::uint64_t>(5));
+
+    test_inverse_modulus<M>(static_cast<T>(3), gen);
+    test_inverse_modulus<M>(static_cast<T>(9), gen);
+    test_inverse_modulus<M>(static_cast<T>(105), gen);
+    test_inverse_modulus<M>(maxmod, gen);
+    test_inverse_modulus<M>(static_cast<T>(maxmod - 2), gen);
+    test_inverse_modulus<M>(static_cast<T>((maxmod / 2) | 1u), gen);
+    for (int i = 0; i < 20; ++i) {
+        T n = static_cast<T>((static_cast<T>(gen()) % maxmod) | 1u);
+        if (n < 3)
+            n = 3;
+        test_inverse_modulus<M>(n, gen);
+    }
+}
+
+
+template <template <class> class Monty>
+void test_inverse_monty()
+{
+    test_inverse<MF<std::uint32_t, Monty<std::uint32_t>>>();
+    test_inverse<MF<std::uint64_t, Monty<std::uint64_t>>>();
+}
+
+
+TEST(MontgomeryArithmetic, inverse_direct) {
+    test_inverse_monty<hc::detail::MontyQuarterRange>();
+    test_inverse_monty<hc::detail::MontyHalfRange>();
+    test_inverse_monty<hc::detail::MontyFullRange>();
+    test_inverse<hc::MontgomeryForm<std::uint64_t>>();
+    test_inverse<hc::MontgomeryMasked<std::uint64_t>>();
+}
+
+
+} // end unnamed namespace
@@ -0,0 +1,171 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/detail/experimental/MontyVecIFMA52.h"
+#include "hurchalla/modular_arithmetic/modular_multiplication.h"
+#include "hurchalla/modular_arithmetic/modular_addition.h"
+#include "hurchalla/modular_arithmetic/modular_subtraction.h"
+#include "hurchalla/modular_arithmetic/modular_pow.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <array>
+#include <random>
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+using MV = hc::detail::MontyVecIFMA52;
+using U = std::uint64_t;
+using LaneArray = MV::lane_array;
+
+
+void test_lanes(const LaneArray& moduli, std::mt19937_64& gen)
+{
+    MV mv(moduli);
+    EXPECT_TRUE(mv.getModulus() == moduli);
+
+    LaneArray a, b, c;
+    for (std::size_t i=0; i<a.size(); ++i) {
+        std::uniform_int_distribution<U> dist(0, moduli[i] - 1);
+        a[i] = dist(gen);
+        b[i] = dist(gen);
+        c[i] = dist(gen);
+    }
+    // make sure we test the extremes of the range too
+    a[0] = 0;
+    b[1] = moduli[1] - 1;
+    a[2] = moduli[2] - 1;
+    b[2] = moduli[2] - 1;
+
+    MV::V x = mv.convertIn(a);
+    MV::V y = mv.convertIn(b);
+    MV::C z = mv.getCanonicalValue(mv.convertIn(c));
+    MV::FV fz = mv.getFusingValue(mv.convertIn(c));
+
+    EXPECT_TRUE(mv.convertOut(x) == a);
+    EXPECT_TRUE(mv.convertOut(y) == b);
+
+    LaneArray prod = mv.convertOut(mv.multiply(x, y));
+    LaneArray sq = mv.convertOut(mv.square(x));
+    LaneArray sum = mv.convertOut(mv.add(x, y));
+    LaneArray diff = mv.convertOut(mv.subtract(x, y));
+    LaneArray neg = mv.convertOut(mv.negate(y));
+    LaneArray fma = mv.convertOut(mv.fmadd(x, y, z));
+    LaneArray fms = mv.convertOut(mv.fmsub(x, y, z));
+    LaneArray fma2 = mv.convertOut(mv.fmadd(x, y, fz));
+    LaneArray fms2 = mv.convertOut(mv.fmsub(x, y, fz));
+    LaneArray csum = mv.convertOut(mv.add(mv.getCanonicalValue(x), z));
+    LaneArray cdiff = mv.convertOut(mv.subtract(mv.getCanonicalValue(x), z));
+    LaneArray one = mv.convertOut(mv.getUnityValue());
+    LaneArray zero = mv.convertOut(mv.getZeroValue());
+    LaneArray negone = mv.convertOut(mv.getNegativeOneValue());
+
+    for (std::size_t i=0; i<a.size(); ++i) {
+        U n = moduli[i];
+        U p = hc::modular_multiplication_prereduced_inputs(a[i], b[i], n);
+        EXPECT_TRUE(prod[i] == p);
+        EXPECT_TRUE(sq[i] ==
+                   hc::modular_multiplication_prereduced_inputs(a[i], a[i], n));
+        EXPECT_TRUE(sum[i] == hc::modular_addition_prereduced_inputs(a[i], b[i], n));
+        EXPECT_TRUE(diff[i] ==
+                     hc::modular_subtraction_prereduced_inputs(a[i], b[i], n));
+        EXPECT_TRUE(neg[i] ==
+                 hc::modular_subtraction_prereduced_inputs(U(0), b[i], n));
+        EXPECT_TRUE(fma[i] == hc::modular_addition_prereduced_inputs(p, c[i], n));
+        EXPECT_TRUE(fms[i] ==
+                       hc::modular_subtraction_prereduced_inputs(p, c[i], n));
+        EXPECT_TRUE(fma2[i] == fma[i]);
+        EXPECT_TRUE(fms2[i] == fms[i]);
+        EXPECT_TRUE(csum[i] ==
+                         hc::modular_addition_prereduced_inputs(a[i], c[i], n));
+        EXPECT_TRUE(cdiff[i] ==
+                      hc::modular_subtraction_prereduced_inputs(a[i], c[i], n));
+        EXPECT_TRUE(one[i] == 1);
+        EXPECT_TRUE(zero[i] == 0);
+        EXPECT_TRUE(negone[i] == n - 1);
+    }
+
+    // a longer dependent chain, to check that values stay within range
+    MV::V acc = mv.getUnityValue();
+    LaneArray expected;
+    for (std::size_t i=0; i<expected.size(); ++i)
+        expected[i] = 1;
+    for (int k=0; k<100; ++k) {
+        acc = mv.fmadd(acc, x, z);
+        acc = mv.square(acc);
+        for (std::size_t i=0; i<expected.size(); ++i) {
+            U n = moduli[i];
+            U t = hc::modular_multiplication_prereduced_inputs(expected[i], a[i], n);
+            t = hc::modular_addition_prereduced_inputs(t, c[i], n);
+            expected[i] = hc::modular_multiplication_prereduced_inputs(t, t, n);
+        }
+    }
+    EXPECT_TRUE(mv.convertOut(acc) == expected);
+
+    // two_pow, with the largest exponent ranging over all bit lengths so that
+    // we cover every possible size of the final (partial) window
+    LaneArray exponents;
+    for (int bits=0; bits<=64; ++bits) {
+        U maxval = (bits == 64) ? ~static_cast<U>(0) :
+                                  (static_cast<U>(1) << bits) - 1;
+        std::uniform_int_distribution<U> edist(0, maxval);
+        for (std::size_t i=0; i<exponents.size(); ++i)
+            exponents[i] = edist(gen);
+        exponents[1] = maxval;
+        exponents[2] = 0;
+        LaneArray tp = mv.convertOut(mv.two_pow(exponents));
+        for (std::size_t i=0; i<tp.size(); ++i)
+            EXPECT_TRUE(tp[i] == hc::modular_pow(U(2), exponents[i], moduli[i]));
+    }
+    // base 2 fermat test exponents
+    for (std::size_t i=0; i<exponents.size(); ++i)
+        exponents[i] = moduli[i] - 1;
+    LaneArray tp = mv.convertOut(mv.two_pow(exponents));
+    for (std::size_t i=0; i<tp.size(); ++i)
+        EXPECT_TRUE(tp[i] == hc::modular_pow(U(2), exponents[i], moduli[i]));
+}
+
+
+TEST(MontgomeryArithmetic, MontyVecIFMA52) {
+    std::mt19937_64 gen(7);
+    constexpr U maxmod = MV::max_modulus();
+    static_assert(maxmod % 2 == 1, "");
+
+    LaneArray small = {{ 3, 5, 7, 9, 11, 13, 15, 17 }};
+    test_lanes(small, gen);
+
+    LaneArray large = {{ maxmod, maxmod - 2, maxmod - 4, maxmod - 6,
+                         maxmod - 8, maxmod - 10, maxmod - 12, maxmod - 14 }};
+    test_lanes(large, gen);
+
+    std::uniform_int_distribution<U> dist(1, maxmod/2);
+    for (int k=0; k<200; ++k) {
+        LaneArray moduli;
+        for (std::size_t i=0; i<moduli.size(); ++i)
+            moduli[i] = 2*dist(gen) + 1;
+        test_lanes(moduli, gen);
+    }
+
+    // the single modulus constructor, using the same modulus in all lanes
+    {
+        U modulus = 1125899906842597;  // largest prime below 2^50
+        MV mv(modulus);
+        LaneArray moduli;
+        moduli.fill(modulus);
+        EXPECT_TRUE(mv.getModulus() == moduli);
+        test_lanes(moduli, gen);
+    }
+}
+
+
+} // end unnamed namespace
@@ -0,0 +1,169 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/detail/experimental/MontyVecU32.h"
+#include "hurchalla/modular_arithmetic/modular_multiplication.h"
+#include "hurchalla/modular_arithmetic/modular_addition.h"
+#include "hurchalla/modular_arithmetic/modular_subtraction.h"
+#include "hurchalla/modular_arithmetic/modular_pow.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <array>
+#include <random>
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+using U = std::uint32_t;
+
+
+template <std::size_t LANES>
+void test_lanes(const std::array<U, LANES>& moduli, std::mt19937_64& gen)
+{
+    using MV = hc::detail::MontyVecU32<LANES>;
+    using LaneArray = typename MV::lane_array;
+    MV mv(moduli);
+    EXPECT_TRUE(mv.getModulus() == moduli);
+
+    LaneArray a, b, c;
+    std::array<std::uint64_t, LANES> exponents;
+    for (std::size_t i=0; i<a.size(); ++i) {
+        std::uniform_int_distribution<U> dist(0, moduli[i] - 1);
+        a[i] = dist(gen);
+        b[i] = dist(gen);
+        c[i] = dist(gen);
+        exponents[i] = gen() >> (gen() % 64);
+    }
+    a[0] = 0;
+    b[1] = moduli[1] - 1;
+    a[2] = moduli[2] - 1;
+    b[2] = moduli[2] - 1;
+    exponents[3] = 0;
+    exponents[4] = ~static_cast<std::uint64_t>(0);
+
+    using V = typename MV::V;
+    V x = mv.convertIn(a);
+    V y = mv.convertIn(b);
+    V z = mv.convertIn(c);
+    EXPECT_TRUE(mv.convertOut(x) == a);
+    EXPECT_TRUE(mv.convertOut(y) == b);
+
+    LaneArray prod = mv.convertOut(mv.multiply(x, y));
+    LaneArray sq = mv.convertOut(mv.square(x));
+    LaneArray sum = mv.convertOut(mv.add(x, y));
+    LaneArray diff = mv.convertOut(mv.subtract(x, y));
+    LaneArray neg = mv.convertOut(mv.negate(y));
+    LaneArray fma = mv.convertOut(mv.fmadd(x, y, z));
+    LaneArray fms = mv.convertOut(mv.fmsub(x, y, z));
+    LaneArray one = mv.convertOut(mv.getUnityValue());
+    LaneArray zero = mv.convertOut(mv.getZeroValue());
+    LaneArray negone = mv.convertOut(mv.getNegativeOneValue());
+    LaneArray pw = mv.convertOut(mv.pow(x, exponents[5]));
+    LaneArray pws = mv.convertOut(mv.pow(x, exponents));
+
+    EXPECT_TRUE(mv.multiply(a, b) == prod);
+    EXPECT_TRUE(mv.square(a) == sq);
+    EXPECT_TRUE(mv.pow(a, exponents[5]) == pw);
+    EXPECT_TRUE(mv.pow(a, exponents) == pws);
+
+    for (std::size_t i=0; i<a.size(); ++i) {
+        U n = moduli[i];
+        U p = hc::modular_multiplication_prereduced_inputs(a[i], b[i], n);
+        EXPECT_TRUE(prod[i] == p);
+        EXPECT_TRUE(sq[i] ==
+                   hc::modular_multiplication_prereduced_inputs(a[i], a[i], n));
+        EXPECT_TRUE(sum[i] == hc::modular_addition_prereduced_inputs(a[i], b[i], n));
+        EXPECT_TRUE(diff[i] ==
+                     hc::modular_subtraction_prereduced_inputs(a[i], b[i], n));
+        EXPECT_TRUE(neg[i] ==
+                     hc::modular_subtraction_prereduced_inputs(U(0), b[i], n));
+        EXPECT_TRUE(fma[i] == hc::modular_addition_prereduced_inputs(p, c[i], n));
+        EXPECT_TRUE(fms[i] ==
+                       hc::modular_subtraction_prereduced_inputs(p, c[i], n));
+        EXPECT_TRUE(one[i] == 1);
+        EXPECT_TRUE(zero[i] == 0);
+        EXPECT_TRUE(negone[i] == n - 1);
+        EXPECT_TRUE(pw[i] == hc::modular_pow(a[i], exponents[5], n));
+        EXPECT_TRUE(pws[i] == hc::modular_pow(a[i], exponents[i], n));
+    }
+
+    // values that are not reduced modulo n are allowed for convertIn
+    LaneArray big;
+    big.fill(static_cast<U>(0xFFFFFFFF));
+    LaneArray bigout = mv.convertOut(mv.convertIn(big));
+    for (std::size_t i=0; i<big.size(); ++i)
+        EXPECT_TRUE(bigout[i] == big[i] % moduli[i]);
+
+    // two_pow, with the largest exponent ranging over all bit lengths so that
+    // we cover every possible size of the final (partial) window
+    for (int bits=0; bits<=64; ++bits) {
+        std::uint64_t maxval = (bits == 64) ? ~static_cast<std::uint64_t>(0) :
+                               (static_cast<std::uint64_t>(1) << bits) - 1;
+        std::uniform_int_distribution<std::uint64_t> edist(0, maxval);
+        for (std::size_t i=0; i<exponents.size(); ++i)
+            exponents[i] = edist(gen);
+        exponents[1] = maxval;
+        exponents[2] = 0;
+        LaneArray tp = mv.convertOut(mv.two_pow(exponents));
+        for (std::size_t i=0; i<tp.size(); ++i)
+            EXPECT_TRUE(tp[i] == hc::modular_pow(U(2), exponents[i], moduli[i]));
+    }
+    // base 2 fermat test exponents
+    for (std::size_t i=0; i<exponents.size(); ++i)
+        exponents[i] = moduli[i] - 1;
+    LaneArray tp = mv.convertOut(mv.two_pow(exponents));
+    for (std::size_t i=0; i<tp.size(); ++i)
+        EXPECT_TRUE(tp[i] == hc::modular_pow(U(2), exponents[i], moduli[i]));
+}
+
+
+template <std::size_t LANES>
+void test_MontyVecU32()
+{
+    std::mt19937_64 gen(11);
+    using LaneArray = std::array<U, LANES>;
+
+    LaneArray small;
+    for (std::size_t i=0; i<small.size(); ++i)
+        small[i] = static_cast<U>(2*i + 3);
+    test_lanes<LANES>(small, gen);
+
+    LaneArray large;
+    for (std::size_t i=0; i<large.size(); ++i)
+        large[i] = static_cast<U>(0xFFFFFFFF - 2*i);
+    test_lanes<LANES>(large, gen);
+
+    std::uniform_int_distribution<U> dist(1, 0x7FFFFFFF);
+    for (int k=0; k<200; ++k) {
+        LaneArray moduli;
+        for (std::size_t i=0; i<moduli.size(); ++i)
+            moduli[i] = 2*dist(gen) + 1;
+        test_lanes<LANES>(moduli, gen);
+    }
+
+    U modulus = 4294967291u;  // largest prime below 2^32
+    hc::detail::MontyVecU32<LANES> mv(modulus);
+    LaneArray moduli;
+    moduli.fill(modulus);
+    EXPECT_TRUE(mv.getModulus() == moduli);
+    test_lanes<LANES>(moduli, gen);
+}
+
+
+TEST(MontgomeryArithmetic, MontyVecU32) {
+    test_MontyVecU32<8>();
+    test_MontyVecU32<16>();
+}
+
+
+} // end unnamed namespace
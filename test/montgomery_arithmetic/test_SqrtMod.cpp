@@ -0,0 +1,198 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/SqrtMod.h"
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/modular_arithmetic/modular_pow.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <random>
+#include <memory>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+// Euler's criterion: for an odd prime p, x is a square mod p if x == 0 or
+// x^((p-1)/2) == 1 (mod p).
+template <typename T>
+bool is_square_mod(T x, T p)
+{
+    return x == 0 || hc::modular_pow<T>(x, static_cast<T>((p - 1)/2), p) == 1;
+}
+
+template <typename T>
+T random_below(std::mt19937_64& gen, T p)
+{
+    T x = static_cast<T>(gen());
+    if HURCHALLA_CPP17_CONSTEXPR (hc::ut_numeric_limits<T>::digits > 64)
+        x = static_cast<T>((x << (hc::ut_numeric_limits<T>::digits > 64 ? 64 : 0))
+                           | static_cast<T>(gen()));
+    return static_cast<T>(x % p);
+}
+
+// checks SqrtMod for the values xs, with both sqrt() and the batch sqrt()
+template <class MF>
+void test_values(const MF& mf, const std::vector<typename MF::IntegerType>& xs)
+{
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+    T p = mf.getModulus();
+    hc::SqrtMod<MF> sm(mf);
+
+    std::vector<V> vals;
+    for (T x : xs)
+        vals.push_back(mf.convertIn(x));
+    std::vector<V> roots(vals.size());
+    // std::vector<bool> has no data(), so we use a plain array of bool (with
+    // one extra element, to avoid a zero size allocation)
+    std::unique_ptr<bool[]> batchIsSquare(new bool[vals.size() + 1]);
+    sm.sqrt(roots.data(), batchIsSquare.get(), vals.data(), vals.size());
+
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+        T x = xs[i];
+        bool expected = is_square_mod(x, p);
+        bool isSquare;
+        V r = sm.sqrt(vals[i], isSquare);
+        EXPECT_TRUE(isSquare == expected);
+        EXPECT_TRUE(batchIsSquare[i] == expected);
+        if (expected) {
+            EXPECT_TRUE(mf.convertOut(mf.square(r)) == x);
+            EXPECT_TRUE(mf.convertOut(mf.square(roots[i])) == x);
+        }
+        bool b;
+        V r2 = hc::sqrt_mod(mf, vals[i], b);
+        EXPECT_TRUE(b == expected);
+        if (expected) {
+            EXPECT_TRUE(mf.convertOut(mf.square(r2)) == x);
+        }
+    }
+}
+
+template <class MF>
+void test_exhaustive(typename MF::IntegerType p)
+{
+    using T = typename MF::IntegerType;
+    std::vector<T> xs;
+    for (T x = 0; x < p; ++x)
+        xs.push_back(x);
+    test_values(MF(p), xs);
+}
+
+template <class MF>
+void test_random(typename MF::IntegerType p, std::mt19937_64& gen)
+{
+    using T = typename MF::IntegerType;
+    MF mf(p);
+    std::vector<T> xs = { 0, 1, 2, 3, 4, static_cast<T>(p - 1),
+                          static_cast<T>(p - 4) };
+    for (int i = 0; i < 200; ++i)
+        xs.push_back(random_below(gen, p));
+    test_values(mf, xs);
+
+    // the root of y*y must be y or -y
+    hc::SqrtMod<MF> sm(mf);
+    for (int i = 0; i < 100; ++i) {
+        T y = random_below(gen, p);
+        auto vy = mf.convertIn(y);
+        bool isSquare;
+        T r = mf.convertOut(sm.sqrt(mf.square(vy), isSquare));
+        EXPECT_TRUE(isSquare);
+        EXPECT_TRUE(r == y || r == static_cast<T>((p - y) % p));
+    }
+}
+
+
+TEST(MontgomeryArithmetic, SqrtMod_small) {
+    // p == 3 mod 4, p == 5 mod 8, and p == 1 mod 8 with increasing s.  With
+    // p == 65537 == 2^16 + 1 and p == 786433 == 3*2^18 + 1, SqrtMod uses
+    // Cipolla's method.
+    const std::uint32_t primes[] = { 3, 5, 7, 13, 17, 43, 97, 257, 7681,
+                                     65537 };
+    for (std::uint32_t p : primes) {
+        test_exhaustive<hc::MontgomeryForm<std::uint32_t>>(p);
+        test_exhaustive<hc::MontgomeryQuarter<std::uint64_t>>(p);
+    }
+    std::mt19937_64 gen(11);
+    test_random<hc::MontgomeryForm<std::uint32_t>>(786433u, gen);
+    test_random<hc::MontgomeryForm<std::uint32_t>>(998244353u, gen);
+}
+
+TEST(MontgomeryArithmetic, SqrtMod_32) {
+    std::mt19937_64 gen(12);
+    using T = std::uint32_t;
+    const T primes[] = { 4294967291u, 4294967197u, 4294967161u,
+                         3221225473u,   // 3*2^30 + 1 (uses Cipolla)
+                         2013265921u };  // 15*2^27 + 1 (uses Cipolla)
+    for (T p : primes) {
+        test_random<hc::MontgomeryForm<T>>(p, gen);
+        test_random<hc::MontgomeryFull<T>>(p, gen);
+    }
+    test_random<hc::MontgomeryQuarter<T>>(1073741789u, gen);  // 2^30-35
+}
+
+TEST(MontgomeryArithmetic, SqrtMod_64) {
+    std::mt19937_64 gen(13);
+    using T = std::uint64_t;
+    const T primes[] = { UINT64_C(18446744073709551557),
+                         UINT64_C(18446744073709551521),
+                         UINT64_C(18446744073709551427),
+                         UINT64_C(18446744069414584321),   // 2^64 - 2^32 + 1
+                         UINT64_C(15564440312192434177),   // 27*2^59 + 1
+                         // SqrtMod uses Tonelli-Shanks for a 64 bit p when
+                         // s <= 25, and Cipolla when s >= 26.
+                         // 549755813829*2^25 + 1
+                         UINT64_C(18446744071729840129),
+                         // 274877906883*2^26 + 1
+                         UINT64_C(18446744069615910913) };
+    for (T p : primes) {
+        test_random<hc::MontgomeryForm<T>>(p, gen);
+        test_random<hc::MontgomeryFull<T>>(p, gen);
+    }
+    const T quarter_primes[] = { UINT64_C(4611686018427387847),
+                                 UINT64_C(4611686018427387817),
+                                 UINT64_C(4611686018427387733),
+                                 // 1099511627715*2^22 + 1 (Tonelli-Shanks)
+                                 UINT64_C(4611686018171535361) };
+    for (T p : quarter_primes)
+        test_random<hc::MontgomeryQuarter<T>>(p, gen);
+}
+
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+TEST(MontgomeryArithmetic, SqrtMod_128) {
+    std::mt19937_64 gen(14);
+    using T = __uint128_t;
+    T top = static_cast<T>(0);
+    // 2^128 - 159, 2^128 - 173, and 2^128 - 275
+    test_random<hc::MontgomeryForm<T>>(static_cast<T>(top - 159), gen);
+    test_random<hc::MontgomeryForm<T>>(static_cast<T>(top - 173), gen);
+    test_random<hc::MontgomeryForm<T>>(static_cast<T>(top - 275), gen);
+    // 7*2^120 + 1 (uses Cipolla)
+    test_random<hc::MontgomeryForm<T>>(
+                      static_cast<T>((static_cast<T>(7) << 120) + 1), gen);
+    // 2^126 - 335
+    test_random<hc::MontgomeryQuarter<T>>(
+                      static_cast<T>((static_cast<T>(1) << 126) - 335), gen);
+}
+#endif
+
+
+} // end unnamed namespace
@@ -0,0 +1,58 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef HURCHALLA_TEST_IS_PRIME_H_INCLUDED
+#define HURCHALLA_TEST_IS_PRIME_H_INCLUDED
+
+
+// Helpers shared by the tests of the primality functions.
+
+
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <vector>
+
+
+namespace {
+
+
+// Returns a vector whose element i is true if i is prime, for all i < limit.
+std::vector<bool> sieve(std::uint32_t limit)
+{
+    std::vector<bool> is_prime(limit, true);
+    is_prime[0] = false;
+    is_prime[1] = false;
+    for (std::uint32_t i=2; i*i<limit; ++i) {
+        if (is_prime[i]) {
+            for (std::uint32_t j=i*i; j<limit; j+=i)
+                is_prime[j] = false;
+        }
+    }
+    return is_prime;
+}
+
+// For every i < is_prime.size(), expects is_prime_func(static_cast<T>(i)) to
+// equal is_prime[i], except that it expects true for every i that is listed in
+// pseudoprimes.
+template <typename T, class F>
+void test_against_sieve(const std::vector<bool>& is_prime, F is_prime_func,
+                        const std::vector<std::uint32_t>& pseudoprimes =
+                                                  std::vector<std::uint32_t>())
+{
+    std::vector<bool> expected = is_prime;
+    for (std::uint32_t p : pseudoprimes) {
+        if (p < expected.size())
+            expected[p] = true;
+    }
+    for (std::uint32_t i=0; i<expected.size(); ++i)
+        EXPECT_TRUE(is_prime_func(static_cast<T>(i)) == expected[i]);
+}
+
+
+} // end unnamed namespace
+
+#endif
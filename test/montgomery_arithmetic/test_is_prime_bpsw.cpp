@@ -0,0 +1,136 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "test_is_prime.h"
+#include "hurchalla/montgomery_arithmetic/is_prime_bpsw.h"
+#include "hurchalla/montgomery_arithmetic/is_prime_miller_rabin.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <vector>
+#include <random>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+// the strong Lucas pseudoprimes (with Selfridge's parameters) below 2^17
+const std::vector<std::uint32_t> strong_lucas_pseudoprimes = { 5459, 5777,
+                  10877, 16109, 18971, 22499, 24569, 25199, 40309, 58519,
+                  75077, 97439, 100127, 113573, 115639, 130139 };
+
+
+template <typename T>
+void test_against_sieve(const std::vector<bool>& is_prime)
+{
+    test_against_sieve<T>(is_prime, hc::is_prime_bpsw<T>);
+    test_against_sieve<T>(is_prime, hc::is_strong_lucas_probable_prime<T>,
+                          strong_lucas_pseudoprimes);
+}
+
+
+TEST(MontgomeryArithmetic, is_prime_bpsw_small) {
+    std::vector<bool> is_prime = sieve(UINT32_C(1) << 17);
+    test_against_sieve<std::uint32_t>(is_prime);
+    test_against_sieve<std::int32_t>(is_prime);
+    test_against_sieve<std::uint64_t>(is_prime);
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_against_sieve<__uint128_t>(is_prime);
+#endif
+    is_prime.resize(UINT32_C(1) << 16);
+    test_against_sieve<std::uint16_t>(is_prime);
+}
+
+TEST(MontgomeryArithmetic, is_prime_bpsw_32) {
+    using T = std::uint32_t;
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>(2147483647)));  // 2^31-1
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>(4294967291u))); // 2^32-5
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(4294967295u)));
+    EXPECT_FALSE(hc::is_strong_lucas_probable_prime(static_cast<T>(4294967295u)));
+    // Carmichael numbers
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(561)));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(3057601)));
+    // strong pseudoprimes to the base 2
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(2047)));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(3215031751u)));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(4294901761u)));
+    // squares of primes
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(65521u * 65521u)));
+    EXPECT_FALSE(hc::is_strong_lucas_probable_prime(static_cast<T>(65521u * 65521u)));
+    EXPECT_FALSE(hc::is_strong_lucas_probable_prime(static_cast<T>(25)));
+}
+
+TEST(MontgomeryArithmetic, is_prime_bpsw_64) {
+    using T = std::uint64_t;
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>((UINT64_C(1) << 61) - 1)));
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>((UINT64_C(1) << 62) - 57)));
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>((UINT64_C(1) << 63) - 25)));
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>(0) - 59));   // 2^64-59
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(0) - 1));
+    EXPECT_FALSE(hc::is_strong_lucas_probable_prime(static_cast<T>(0) - 1));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(4294967291u) * 4294967291u));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(4294967291u) * 2147483647));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(UINT64_C(4759123141))));
+    // a strong pseudoprime to the prime bases 2 through 31
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(UINT64_C(3825123056546413051))));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<std::int64_t>(
+                                         INT64_C(3825123056546413051))));
+
+    // compare with is_prime_miller_rabin, which is proven correct below 2^64
+    std::mt19937_64 gen(3);
+    for (int i=0; i<20000; ++i) {
+        T x = gen() >> (i % 40);
+        EXPECT_TRUE(hc::is_prime_bpsw(x) == hc::is_prime_miller_rabin(x));
+        if (hc::is_prime_miller_rabin(x)) {
+            EXPECT_TRUE(hc::is_strong_lucas_probable_prime(x));
+        }
+    }
+}
+
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+TEST(MontgomeryArithmetic, is_prime_bpsw_128) {
+    using T = __uint128_t;
+    T one = 1;
+    EXPECT_TRUE(hc::is_prime_bpsw((one << 89) - 1));
+    EXPECT_TRUE(hc::is_prime_bpsw((one << 126) - 137));
+    EXPECT_TRUE(hc::is_prime_bpsw((one << 127) - 1));
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>(0) - 159));  // 2^128-159
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<T>((one << 64) - 59)));
+    EXPECT_TRUE(hc::is_prime_bpsw(static_cast<__int128_t>((one << 127) - 1)));
+    EXPECT_TRUE(hc::is_strong_lucas_probable_prime((one << 127) - 1));
+    EXPECT_FALSE(hc::is_prime_bpsw(static_cast<T>(0) - 1));
+    EXPECT_FALSE(hc::is_strong_lucas_probable_prime(static_cast<T>(0) - 1));
+    EXPECT_FALSE(hc::is_prime_bpsw(((one << 61) - 1) * ((one << 31) - 1)));
+    EXPECT_FALSE(hc::is_prime_bpsw(((one << 61) - 1) * ((one << 61) - 1)));
+    EXPECT_FALSE(hc::is_strong_lucas_probable_prime(
+                                       ((one << 61) - 1) * ((one << 61) - 1)));
+    EXPECT_FALSE(hc::is_prime_bpsw(((one << 64) - 59) * ((one << 63) - 25)));
+    // a strong pseudoprime to the prime bases 2 through 37
+    T spsp = static_cast<T>(UINT64_C(318665857834)) * UINT64_C(1000000000000)
+             + UINT64_C(31151167461);
+    EXPECT_FALSE(hc::is_prime_bpsw(spsp));
+
+    std::mt19937_64 gen(5);
+    for (int i=0; i<3000; ++i) {
+        T x = (static_cast<T>(gen()) << 64 | gen()) >> (i % 60);
+        EXPECT_TRUE(hc::is_prime_bpsw(x) == hc::is_prime_miller_rabin(x));
+    }
+}
+#endif
+
+
+} // end unnamed namespace
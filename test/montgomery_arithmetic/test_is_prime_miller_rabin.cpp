@@ -0,0 +1,153 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "test_is_prime.h"
+#include "hurchalla/montgomery_arithmetic/is_prime_miller_rabin.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <vector>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+bool is_prime_trial_division(std::uint64_t x)
+{
+    if (x < 2)
+        return false;
+    for (std::uint64_t d=2; d*d<=x; ++d) {
+        if (x % d == 0)
+            return false;
+    }
+    return true;
+}
+
+
+template <typename T>
+void test_against_sieve(const std::vector<bool>& is_prime)
+{
+    test_against_sieve<T>(is_prime, hc::is_prime_miller_rabin<T>);
+}
+
+// checks the numbers near each boundary where is_prime_miller_rabin switches
+// between MontgomeryQuarter, MontgomeryHalf, MontgomeryFull, and integer types
+template <typename T>
+void test_boundaries_trial_division()
+{
+    const std::uint64_t boundaries[] = { UINT64_C(1) << 30, UINT64_C(1) << 31,
+                                         UINT64_C(1) << 32 };
+    for (std::uint64_t b : boundaries) {
+        for (std::uint64_t x = b - 300; x < b + 300; ++x) {
+            if (x <= static_cast<std::uint64_t>(hc::ut_numeric_limits<T>::max())) {
+                EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>(x)) ==
+                            is_prime_trial_division(x));
+            }
+        }
+    }
+}
+
+
+TEST(MontgomeryArithmetic, is_prime_miller_rabin_small) {
+    std::vector<bool> is_prime = sieve(UINT32_C(1) << 16);
+    test_against_sieve<std::uint16_t>(is_prime);
+    test_against_sieve<std::int16_t>(std::vector<bool>(is_prime.begin(),
+                                                   is_prime.begin() + 32768));
+    test_against_sieve<std::uint8_t>(std::vector<bool>(is_prime.begin(),
+                                                   is_prime.begin() + 256));
+
+    is_prime = sieve(UINT32_C(1) << 20);
+    test_against_sieve<std::uint32_t>(is_prime);
+    test_against_sieve<std::int64_t>(is_prime);
+    test_against_sieve<std::uint64_t>(is_prime);
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_against_sieve<__uint128_t>(is_prime);
+#endif
+
+    test_boundaries_trial_division<std::uint32_t>();
+    test_boundaries_trial_division<std::int32_t>();
+    test_boundaries_trial_division<std::uint64_t>();
+}
+
+TEST(MontgomeryArithmetic, is_prime_miller_rabin_32) {
+    using T = std::uint32_t;
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>(1073741789)));  // 2^30-35
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>(2147483647)));  // 2^31-1
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>(4294967291u))); // 2^32-5
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(4294967295u)));
+    // Carmichael numbers
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(561)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(41041)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(3057601)));
+    // strong pseudoprimes to the bases 2, 3, 5, and 7, and to the base 2
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(3215031751u)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(2047)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(4294901761u)));
+    // 65521 is the largest prime less than 2^16
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(65521u * 65521u)));
+}
+
+TEST(MontgomeryArithmetic, is_prime_miller_rabin_64) {
+    using T = std::uint64_t;
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>((UINT64_C(1) << 61) - 1)));
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>((UINT64_C(1) << 62) - 57)));
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>((UINT64_C(1) << 63) - 25)));
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>(0) - 59));   // 2^64-59
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>(4294967311u)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(0) - 1));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(0) - 61));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(
+                             static_cast<T>(4294967291u) * 4294967291u));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(
+                             static_cast<T>(2147483647) * 2147483647));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(
+                             static_cast<T>(4294967291u) * 2147483647));
+    // a strong pseudoprime to the bases 2, 7, and 61
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(UINT64_C(4759123141))));
+    // a strong pseudoprime to the prime bases 2 through 31
+    EXPECT_FALSE(hc::is_prime_miller_rabin(
+                             static_cast<T>(UINT64_C(3825123056546413051))));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(
+                             static_cast<std::int64_t>(INT64_C(3825123056546413051))));
+    EXPECT_TRUE(hc::is_prime_miller_rabin(
+                             static_cast<std::int64_t>((UINT64_C(1) << 61) - 1)));
+}
+
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+TEST(MontgomeryArithmetic, is_prime_miller_rabin_128) {
+    using T = __uint128_t;
+    T one = 1;
+    EXPECT_TRUE(hc::is_prime_miller_rabin((one << 89) - 1));
+    EXPECT_TRUE(hc::is_prime_miller_rabin((one << 126) - 137));
+    EXPECT_TRUE(hc::is_prime_miller_rabin((one << 127) - 1));
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>(0) - 159));  // 2^128-159
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<T>((one << 64) - 59)));
+    EXPECT_TRUE(hc::is_prime_miller_rabin(static_cast<__int128_t>((one << 127) - 1)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(static_cast<T>(0) - 1));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(one << 81));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(((one << 61) - 1) * ((one << 31) - 1)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(((one << 61) - 1) * ((one << 61) - 1)));
+    EXPECT_FALSE(hc::is_prime_miller_rabin(((one << 64) - 59) * ((one << 63) - 25)));
+    // a strong pseudoprime to the prime bases 2 through 37 (but not 41)
+    T spsp = static_cast<T>(UINT64_C(318665857834)) * UINT64_C(1000000000000)
+             + UINT64_C(31151167461);
+    EXPECT_FALSE(hc::is_prime_miller_rabin(spsp));
+}
+#endif
+
+
+} // end unnamed namespace
@@ -0,0 +1,112 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/make_montgomery_forms.h"
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/montgomery_arithmetic/detail/MontgomeryFormExtensions.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <iterator>
+#include <random>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+template <class MF>
+void test_make_forms(const std::vector<typename MF::IntegerType>& moduli)
+{
+    using T = typename MF::IntegerType;
+    std::vector<MF> forms;
+    forms.reserve(moduli.size());
+    auto it = hc::make_montgomery_forms<MF>(moduli.data(), moduli.size(),
+                                            std::back_inserter(forms));
+    (void)it;
+    EXPECT_TRUE(forms.size() == moduli.size());
+
+    using MFE = hc::detail::MontgomeryFormExtensions<MF, hc::LowlatencyTag>;
+    for (std::size_t i=0; i<moduli.size(); ++i) {
+        const MF& mf = forms[i];
+        MF expected(moduli[i]);
+        EXPECT_TRUE(mf.getModulus() == moduli[i]);
+        EXPECT_TRUE(mf.getUnityValue() == expected.getUnityValue());
+        EXPECT_TRUE(mf.getNegativeOneValue() == expected.getNegativeOneValue());
+        EXPECT_TRUE(MFE::getMontvalueR(mf) == MFE::getMontvalueR(expected));
+
+        T a = static_cast<T>(moduli[i] - 1);
+        T b = static_cast<T>(moduli[i] / 3);
+        auto x = mf.convertIn(a);
+        auto y = mf.convertIn(b);
+        EXPECT_TRUE(mf.convertOut(x) == a);
+        EXPECT_TRUE(mf.convertOut(mf.multiply(x, y)) ==
+               expected.convertOut(expected.multiply(expected.convertIn(a),
+                                                     expected.convertIn(b))));
+    }
+}
+
+
+template <class MF>
+void test_make_forms_all()
+{
+    using T = typename MF::IntegerType;
+    T maxmod = MF::max_modulus();
+    std::mt19937_64 gen(7);
+
+    // the sizes cover empty input, and partial, full, and multiple chunks
+    std::size_t sizes[] = { 0, 1, 15, 16, 17, 100 };
+    for (std::size_t size : sizes) {
+        std::vector<T> moduli(size);
+        for (std::size_t i=0; i<size; ++i) {
+            if (i % 4 == 0)
+                moduli[i] = static_cast<T>(2*i + 3);
+            else if (i % 4 == 1)
+                moduli[i] = static_cast<T>(maxmod - static_cast<T>(2*i));
+            else {
+                T val = static_cast<T>(gen());
+                if (hc::ut_numeric_limits<T>::digits > 64)
+                    val = static_cast<T>(val * static_cast<T>(gen()));
+                val = static_cast<T>((val % maxmod) | static_cast<T>(1));
+                moduli[i] = (val < 3) ? static_cast<T>(3) : val;
+            }
+        }
+        test_make_forms<MF>(moduli);
+    }
+}
+
+
+TEST(MontgomeryArithmetic, make_montgomery_forms) {
+    test_make_forms_all<hc::MontgomeryForm<std::uint32_t>>();
+    test_make_forms_all<hc::MontgomeryForm<std::uint64_t>>();
+    test_make_forms_all<hc::MontgomeryForm<std::int64_t>>();
+    test_make_forms_all<hc::MontgomeryQuarter<std::uint64_t>>();
+    test_make_forms_all<hc::MontgomeryHalf<std::uint64_t>>();
+    test_make_forms_all<hc::MontgomeryFull<std::uint32_t>>();
+    test_make_forms_all<hc::MontgomeryMasked<std::uint64_t>>();
+    test_make_forms_all<hc::MontgomeryStandardMathWrapper<std::uint64_t>>();
+    test_make_forms_all<hc::MontgomeryForm<std::uint64_t, false>>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    test_make_forms_all<hc::MontgomeryForm<__uint128_t>>();
+    test_make_forms_all<hc::MontgomeryQuarter<__uint128_t>>();
+#endif
+}
+
+
+} // end unnamed namespace
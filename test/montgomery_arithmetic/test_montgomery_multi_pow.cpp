@@ -0,0 +1,115 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <random>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+// compares multi_pow against the product of separate pow() calls
+template <std::size_t NUM_BASES, class M>
+void test_multi_pow(const M& mf,
+                    const std::array<typename M::IntegerType, NUM_BASES>& bases,
+                    const std::array<typename M::IntegerType, NUM_BASES>& exponents)
+{
+    using V = typename M::MontgomeryValue;
+    std::array<V, NUM_BASES> mv_bases;
+    V expected = mf.getUnityValue();
+    for (std::size_t i=0; i<NUM_BASES; ++i) {
+        mv_bases[i] = mf.convertIn(bases[i]);
+        expected = mf.multiply(expected, mf.pow(mv_bases[i], exponents[i]));
+    }
+    V result = mf.multi_pow(mv_bases, exponents);
+    EXPECT_TRUE(mf.getCanonicalValue(result) == mf.getCanonicalValue(expected));
+}
+
+
+template <std::size_t NUM_BASES, class M>
+void test_random_multi_pow(const M& mf, std::mt19937_64& gen)
+{
+    using T = typename M::IntegerType;
+    constexpr T maxT = hc::ut_numeric_limits<T>::max();
+    T modulus = mf.getModulus();
+    std::array<T, NUM_BASES> bases, exponents;
+    for (std::size_t i=0; i<NUM_BASES; ++i) {
+        bases[i] = static_cast<T>((static_cast<T>(gen()) & maxT) % modulus);
+        // vary the bit lengths of the exponents
+        T e = static_cast<T>(static_cast<T>(gen()) & maxT);
+        exponents[i] = static_cast<T>(e >> (i % hc::ut_numeric_limits<T>::digits));
+    }
+    test_multi_pow<NUM_BASES>(mf, bases, exponents);
+}
+
+
+template <typename M>
+void run_multi_pow_tests()
+{
+    using T = typename M::IntegerType;
+    std::mt19937_64 gen(17);
+    T max = M::max_modulus();
+    T moduli[] = { 3, 13, static_cast<T>(max - 2), max };
+    for (T modulus : moduli) {
+        M mf(modulus);
+        T b0 = static_cast<T>(modulus - 1);
+        T b1 = static_cast<T>(modulus / 2);
+        T b2 = static_cast<T>(2 % modulus);
+        T emax = hc::ut_numeric_limits<T>::max();
+
+        test_multi_pow<1>(mf, {{ b0 }}, {{ 0 }});
+        test_multi_pow<1>(mf, {{ b1 }}, {{ emax }});
+        test_multi_pow<2>(mf, {{ b0, b1 }}, {{ 0, 0 }});
+        test_multi_pow<2>(mf, {{ b0, b1 }}, {{ 1, 0 }});
+        test_multi_pow<2>(mf, {{ b1, b2 }}, {{ emax, 5 }});
+        test_multi_pow<3>(mf, {{ 0, b1, b2 }}, {{ 7, 8, 9 }});
+        test_multi_pow<3>(mf, {{ b0, b1, b2 }}, {{ emax, emax, emax }});
+
+        for (int i=0; i<10; ++i) {
+            test_random_multi_pow<2>(mf, gen);
+            test_random_multi_pow<3>(mf, gen);
+            test_random_multi_pow<5>(mf, gen);
+            test_random_multi_pow<8>(mf, gen);
+        }
+    }
+}
+
+
+TEST(MontgomeryArithmetic, montgomery_multi_pow) {
+    run_multi_pow_tests<hc::MontgomeryForm<std::uint8_t>>();
+    run_multi_pow_tests<hc::MontgomeryForm<std::uint16_t>>();
+    run_multi_pow_tests<hc::MontgomeryForm<std::uint32_t>>();
+    run_multi_pow_tests<hc::MontgomeryForm<std::uint64_t>>();
+    run_multi_pow_tests<hc::MontgomeryForm<std::int64_t>>();
+    run_multi_pow_tests<hc::MontgomeryQuarter<std::uint64_t>>();
+    run_multi_pow_tests<hc::MontgomeryHalf<std::uint64_t>>();
+    run_multi_pow_tests<hc::MontgomeryFull<std::uint32_t>>();
+    run_multi_pow_tests<hc::MontgomeryStandardMathWrapper<std::uint64_t>>();
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+    run_multi_pow_tests<hc::MontgomeryForm<__uint128_t>>();
+    run_multi_pow_tests<hc::MontgomeryQuarter<__uint128_t>>();
+#endif
+}
+
+
+} // end unnamed namespace
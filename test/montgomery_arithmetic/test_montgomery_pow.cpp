@@ -59,6 +59,55 @@ void test_pow_array(M& mf, typename M::IntegerType base,
     }
 }
 
+template <typename M>
+void test_pow_runtime_count(M& mf, typename M::IntegerType base,
+                                   typename M::IntegerType exponent)
+{
+    using T = typename M::IntegerType;
+    using V = typename M::MontgomeryValue;
+
+    T modulus = mf.getModulus();
+
+    // the counts cover zero, partial chunks, and multiple chunks plus remainder
+    constexpr std::size_t MAX_COUNT = 13;
+    std::array<T, MAX_COUNT> bases;
+    std::array<V, MAX_COUNT> mv_bases;
+    for (std::size_t i=0; i<bases.size(); ++i) {
+        bases[i] = static_cast<T>((base + i) % modulus);
+        mv_bases[i] = mf.convertIn(bases[i]);
+    }
+    for (std::size_t count=0; count<=MAX_COUNT; ++count) {
+        std::array<V, MAX_COUNT> mv_result;
+        mf.pow(mv_result.data(), mv_bases.data(), count, exponent);
+        for (std::size_t i=0; i<count; ++i) {
+            EXPECT_TRUE(mf.convertOut(mv_result[i]) ==
+                           hc::modular_pow<T>(bases[i], exponent, modulus));
+        }
+    }
+}
+
+template <typename M, std::size_t NUM_BASES>
+void test_pow_multiform(const std::array<M, NUM_BASES>& mfs,
+                        const std::array<typename M::IntegerType, NUM_BASES>& bases,
+                        const std::array<typename M::IntegerType, NUM_BASES>& exponents)
+{
+    using T = typename M::IntegerType;
+    using V = typename M::MontgomeryValue;
+
+    std::array<T, NUM_BASES> reduced_bases;
+    std::array<V, NUM_BASES> mv_bases;
+    for (std::size_t i=0; i<NUM_BASES; ++i) {
+        reduced_bases[i] = static_cast<T>(bases[i] % mfs[i].getModulus());
+        mv_bases[i] = mfs[i].convertIn(reduced_bases[i]);
+    }
+    std::array<V, NUM_BASES> mv_result = M::pow(mfs, mv_bases, exponents);
+    for (std::size_t i=0; i<NUM_BASES; ++i) {
+        EXPECT_TRUE(mfs[i].convertOut(mv_result[i]) ==
+                       hc::modular_pow<T>(reduced_bases[i], exponents[i],
+                                          mfs[i].getModulus()));
+    }
+}
+
 template <typename M>
 void test_pow(M& mf, typename M::IntegerType base,
                      typename M::IntegerType exponent)
@@ -72,6 +121,8 @@ void test_pow(M& mf, typename M::IntegerType base,
 
     // then try the array template overload of pow using different array sizes
     test_pow_array<2>(mf, base, exponent);
+    // and the runtime count overload of pow
+    test_pow_runtime_count(mf, base, exponent);
 #ifdef HURCHALLA_TEST_MODULAR_ARITHMETIC_HEAVYWEIGHT
     test_pow_array<1>(mf, base, exponent);
     test_pow_array<3>(mf, base, exponent);
@@ -167,6 +218,28 @@ void run_pow_tests()
         base=0; exponent=123;
         test_pow(mf, base, exponent);
     }
+
+    // Try the static array pow, which has a different modulus and exponent for
+    // each base.  The exponents have different bit lengths, including zero.
+    {
+        T max = M::max_modulus();
+        T mod0 = (max >= 113) ? static_cast<T>(113) : static_cast<T>(3);
+        std::array<M, 1> mf1 = {{ M(max) }};
+        std::array<T, 1> b1 = {{ static_cast<T>(max-3) }};
+        std::array<T, 1> e1 = {{ 253 }};
+        test_pow_multiform(mf1, b1, e1);
+
+        std::array<M, 4> mf4 = {{ M(mod0), M(max), M(static_cast<T>(max-2)),
+                                  M((M::max_modulus()/4)*2 + 1) }};
+        std::array<T, 4> b4 = {{ 71, static_cast<T>(max-1), 0,
+                                 static_cast<T>(max/2) }};
+        std::array<T, 4> e4 = {{ 1, static_cast<T>(934), 0, 43 }};
+        test_pow_multiform(mf4, b4, e4);
+        e4 = {{ 0, 0, 0, 0 }};
+        test_pow_multiform(mf4, b4, e4);
+        e4 = {{ 179, 2, 24, 1 }};
+        test_pow_multiform(mf4, b4, e4);
+    }
 }
 
 
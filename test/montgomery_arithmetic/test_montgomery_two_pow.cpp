@@ -127,6 +127,45 @@ void test_two_pow_array(typename MF::IntegerType starting_modulus,
 }
 
 
+// tests the array version of two_pow that uses a single MontgomeryForm for
+// every exponent
+template <class MF, std::size_t ARRAY_SIZE, typename U>
+void test_two_pow_shared_form(typename MF::IntegerType modulus,
+                              U starting_exponent)
+{
+    static_assert(hc::ut_numeric_limits<U>::is_integer, "");
+    static_assert(!hc::ut_numeric_limits<U>::is_signed, "");
+    using T = typename MF::IntegerType;
+    using V = typename MF::MontgomeryValue;
+
+    MF mf(modulus);
+    std::array<U, ARRAY_SIZE> exponents;
+    U expo = starting_exponent;
+    for (std::size_t i=0; i<ARRAY_SIZE; ++i) {
+        exponents[i] = expo;
+        // vary the exponents' bit lengths, and not only their low bits
+        expo = static_cast<U>((expo >> 1) + 3*i);
+    }
+    std::array<V,ARRAY_SIZE> results = two_pow::call(mf, exponents);
+    for (std::size_t i=0; i<ARRAY_SIZE; ++i) {
+        T answer = hc::modular_pow<T>(2, exponents[i], modulus);
+        EXPECT_TRUE(mf.convertOut(results[i]) == answer);
+    }
+
+    // test the MontgomeryForm member function, which takes type T exponents
+    std::array<T, ARRAY_SIZE> t_exponents;
+    for (std::size_t i=0; i<ARRAY_SIZE; ++i) {
+        t_exponents[i] = static_cast<T>(exponents[i] &
+                         static_cast<U>(hc::ut_numeric_limits<T>::max()));
+    }
+    results = mf.two_pow(t_exponents);
+    for (std::size_t i=0; i<ARRAY_SIZE; ++i) {
+        T answer = hc::modular_pow<T>(2, t_exponents[i], modulus);
+        EXPECT_TRUE(mf.convertOut(results[i]) == answer);
+    }
+}
+
+
 template <typename M, typename U>
 void test_two_pow(typename M::IntegerType modulus, U exponent)
 {
@@ -146,6 +185,9 @@ void test_two_pow(typename M::IntegerType modulus, U exponent)
     test_two_pow_array<M,1>(modulus, exponent);
     test_two_pow_array<M,2>(modulus, exponent);
     test_two_pow_array<M,3>(modulus, exponent);
+
+    test_two_pow_shared_form<M,1>(modulus, exponent);
+    test_two_pow_shared_form<M,4>(modulus, exponent);
 #ifdef HURCHALLA_TEST_MODULAR_ARITHMETIC_HEAVYWEIGHT
     test_two_pow_array<M,4>(modulus, exponent);
     test_two_pow_array<M,5>(modulus, exponent);
@@ -0,0 +1,132 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// Strictly for testing purposes, we'll ensure clockwork asserts are
+// enabled by defining HURCHALLA_CLOCKWORK_ENABLE_ASSERTS.
+#ifndef HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#  define HURCHALLA_CLOCKWORK_ENABLE_ASSERTS
+#endif
+
+#include "hurchalla/montgomery_arithmetic/pollard_rho_brent.h"
+#include "hurchalla/montgomery_arithmetic/is_prime_miller_rabin.h"
+#include "hurchalla/montgomery_arithmetic/MontgomeryForm.h"
+#include "hurchalla/montgomery_arithmetic/montgomery_form_aliases.h"
+#include "hurchalla/util/traits/ut_numeric_limits.h"
+#include "hurchalla/util/compiler_macros.h"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstddef>
+
+
+namespace {
+
+
+namespace hc = ::hurchalla;
+
+
+struct GcdFunctor {
+    template <typename T>
+    T operator()(T a, T b) const
+    {
+        static_assert(hc::ut_numeric_limits<T>::is_integer, "");
+        static_assert(!hc::ut_numeric_limits<T>::is_signed, "");
+        while (a != 0) {
+            T tmp = a;
+            a = static_cast<T>(b % a);
+            b = tmp;
+        }
+        return b;
+    }
+};
+
+
+template <class MF, std::size_t NUM_WALKS>
+void test_factor(typename MF::IntegerType n)
+{
+    using T = typename MF::IntegerType;
+    MF mf(n);
+    T f = hc::pollard_rho_brent<NUM_WALKS>(mf, GcdFunctor());
+    EXPECT_TRUE(1 < f && f < n);
+    EXPECT_TRUE(n % f == 0);
+}
+
+template <class MF>
+void test_all_walks(typename MF::IntegerType n)
+{
+    test_factor<MF, 1>(n);
+    test_factor<MF, 2>(n);
+    test_factor<MF, 4>(n);
+    using T = typename MF::IntegerType;
+    MF mf(n);
+    T f = hc::pollard_rho_brent(mf, GcdFunctor());
+    EXPECT_TRUE(1 < f && f < n);
+    EXPECT_TRUE(n % f == 0);
+}
+
+
+TEST(MontgomeryArithmetic, pollard_rho_brent_small) {
+    // every odd composite below 6000
+    for (std::uint32_t n = 9; n < 6000; n += 2) {
+        if (!hc::is_prime_miller_rabin(n)) {
+            test_factor<hc::MontgomeryForm<std::uint32_t>, 1>(n);
+            test_factor<hc::MontgomeryForm<std::uint32_t>, 4>(n);
+            test_factor<hc::MontgomeryQuarter<std::uint64_t>, 3>(n);
+        }
+    }
+}
+
+TEST(MontgomeryArithmetic, pollard_rho_brent_32) {
+    using T = std::uint32_t;
+    // 65521 and 65519 are the two largest 16 bit primes
+    test_all_walks<hc::MontgomeryFull<T>>(static_cast<T>(65521u * 65519u));
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(65521u * 65519u));
+    test_all_walks<hc::MontgomeryQuarter<T>>(static_cast<T>(1048583u * 1021u));
+    test_all_walks<hc::MontgomeryHalf<T>>(static_cast<T>(46337u * 46327u));
+    // prime powers
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(65521u * 65521u));
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(3486784401u)); // 3^20
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(1594323u)); // 3^13
+}
+
+TEST(MontgomeryArithmetic, pollard_rho_brent_64) {
+    using T = std::uint64_t;
+    // 4294967291 and 4294967279 are the two largest 32 bit primes
+    T n = static_cast<T>(4294967291u) * 4294967279u;
+    test_all_walks<hc::MontgomeryFull<T>>(n);
+    test_all_walks<hc::MontgomeryForm<T>>(n);
+    n = static_cast<T>(1073741827u) * 1048583u;
+    test_all_walks<hc::MontgomeryQuarter<T>>(n);
+    test_all_walks<hc::MontgomeryHalf<T>>(n);
+    // prime powers
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(1048583u) * 1048583u);
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(1048583u) * 1048583u
+                                          * 1048583u);
+    // a semiprime with a small and a large factor
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(4294967291u) * 17u);
+    // three prime factors, of very different sizes
+    test_all_walks<hc::MontgomeryForm<T>>(static_cast<T>(4294967291u) * 65521u
+                                          * 17u);
+}
+
+#if HURCHALLA_COMPILER_HAS_UINT128_T()
+TEST(MontgomeryArithmetic, pollard_rho_brent_128) {
+    using T = __uint128_t;
+    // 4611686018427388039 is the smallest prime above 2^62
+    T n = static_cast<T>(4611686018427388039u) * 1073741827u;
+    test_factor<hc::MontgomeryQuarter<T>, 4>(n);
+    test_factor<hc::MontgomeryFull<T>, 4>(n);
+    test_factor<hc::MontgomeryForm<T>, 1>(n);
+    // a 128 bit modulus
+    n = static_cast<T>(4611686018427388039u) * 4611686018427388039u * 13u;
+    test_factor<hc::MontgomeryFull<T>, 4>(n);
+    n = static_cast<T>(4294967291u) * 4294967279u * 1048583u;
+    test_factor<hc::MontgomeryHalf<T>, 2>(n);
+}
+#endif
+
+
+} // end unnamed namespace
@@ -0,0 +1,44 @@
+// Copyright (c) 2025 Jeffrey Hurchalla.
+/*
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+// The SIMD test executables (see CMakeLists.txt) compile their tests with
+// instruction set flags like -mavx2 or -mavx512f -mavx512ifma, so that the
+// intrinsics code paths get built and tested.  Those code paths are selected
+// at compile time, so this file, which is linked into each SIMD executable,
+// skips every test when the CPU lacks an instruction set the compiler targets.
+
+#include "gtest/gtest.h"
+
+
+namespace {
+
+
+class SimdCpuCheck final : public ::testing::Environment {
+ public:
+    void SetUp() override
+    {
+#if defined(__AVX2__)
+        if (!__builtin_cpu_supports("avx2"))
+            GTEST_SKIP() << "this CPU does not support AVX2";
+#endif
+#if defined(__AVX512F__)
+        if (!__builtin_cpu_supports("avx512f"))
+            GTEST_SKIP() << "this CPU does not support AVX-512F";
+#endif
+#if defined(__AVX512IFMA__)
+        if (!__builtin_cpu_supports("avx512ifma"))
+            GTEST_SKIP() << "this CPU does not support AVX-512 IFMA";
+#endif
+    }
+};
+
+// gtest takes ownership of the environment.
+::testing::Environment* const simd_cpu_check =
+                ::testing::AddGlobalTestEnvironment(new SimdCpuCheck);
+
+
+} // end unnamed namespace